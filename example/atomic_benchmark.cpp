@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// atomic_benchmark.cpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Compares three ways for many threads to share one set of statistics:
+//  an accumulator_set behind a mutex, an accumulator_set of the atomic
+//  features, and a concurrent_accumulator_set.
+//
+//  usage: atomic_benchmark [samples-per-thread [max-threads]]
+
+#include <cstdlib>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/framework/concurrent_accumulator_set.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/atomic_count.hpp>
+#include <boost/accumulators/statistics/atomic_sum.hpp>
+#include <boost/accumulators/statistics/atomic_min.hpp>
+#include <boost/accumulators/statistics/atomic_max.hpp>
+
+using namespace boost::accumulators;
+
+typedef stats<tag::count, tag::sum, tag::min, tag::max, tag::mean> plain_stats;
+typedef stats<tag::atomic_count, tag::atomic_sum, tag::atomic_min, tag::atomic_max, tag::mean> atomic_stats;
+
+struct mutex_set
+{
+    void operator ()(double x)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->acc(x);
+    }
+
+    std::mutex mutex;
+    accumulator_set<double, plain_stats> acc;
+};
+
+// Runs push(x) for n samples on each of the given number of threads and
+// returns the average time per sample in nanoseconds.
+template<typename Set>
+double run(Set &set, std::size_t threads, std::size_t n)
+{
+    std::vector<std::thread> workers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(std::size_t t = 0; t < threads; ++t)
+    {
+        workers.push_back(std::thread([&set, t, n] {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                set(static_cast<double>((i * 7919 + t) % 1000));
+            }
+        }));
+    }
+    for(std::size_t t = 0; t < threads; ++t)
+    {
+        workers[t].join();
+    }
+    double const ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / static_cast<double>(n * threads);
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const n = argc > 1 ? static_cast<std::size_t>(std::atof(argv[1])) : 1000000;
+    std::size_t const max_threads = argc > 2 ? std::atoi(argv[2]) : 64;
+
+    std::cout << "ns per sample, " << n << " samples per thread\n"
+              << "threads       mutex      atomic     sharded\n";
+
+    for(std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        mutex_set locked;
+        accumulator_set<double, atomic_stats> atomic;
+        concurrent_accumulator_set<double, plain_stats> sharded;
+
+        double const t_locked = run(locked, threads, n);
+        double const t_atomic = run(atomic, threads, n);
+        double const t_sharded = run(sharded, threads, n);
+
+        std::cout.width(7);
+        std::cout << threads;
+        std::cout.width(12);
+        std::cout << t_locked;
+        std::cout.width(12);
+        std::cout << t_atomic;
+        std::cout.width(12);
+        std::cout << t_sharded << '\n';
+
+        // the three must agree
+        if(mean(locked.acc) != mean(atomic) || mean(atomic) != mean(sharded))
+        {
+            std::cout << "mismatch: " << mean(locked.acc) << ' ' << mean(atomic) << ' ' << mean(sharded) << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+// parallel_benchmark.cpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Measures how parallel_accumulate() scales with the number of threads.
+//
+//  usage: parallel_benchmark [samples [max-threads]]
+//
+//  The default is 1e8 samples (800 MB). Each thread count runs twice on the
+//  same executor, the first time including the start of its threads.
+
+#include <cstdlib>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/framework/parallel_accumulate.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+
+using namespace boost::accumulators;
+
+typedef accumulator_set<double, stats<tag::mean, tag::variance, tag::min, tag::max> > acc_type;
+
+// print every statistic, so that none of them can be optimized away
+std::ostream &operator <<(std::ostream &sout, acc_type const &acc)
+{
+    return sout << "mean " << mean(acc) << ", variance " << variance(acc)
+                << ", min " << (min)(acc) << ", max " << (max)(acc);
+}
+
+template<typename F>
+double seconds(F f)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const size = argc > 1 ? static_cast<std::size_t>(std::atof(argv[1])) : 100000000;
+    std::size_t const max_threads = argc > 2 ? std::atoi(argv[2]) : thread_executor().concurrency();
+
+    std::vector<double> data(size);
+    unsigned int seed = 1;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data[i] = static_cast<double>(seed >> 8) / 16777216.;
+    }
+
+    acc_type acc;
+    double const baseline = seconds([&] {
+        acc = std::for_each(data.begin(), data.end(), acc_type());
+    });
+    std::cout << "samples:   " << size << '\n'
+              << "for_each:  " << baseline << " s  (" << acc << ")\n";
+
+    double single = 0.;
+    for(std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        thread_executor const exec(threads);
+        double const cold = seconds([&] {
+            acc = parallel_accumulate(data.begin(), data.end(), acc_type(), exec);
+        });
+        double const t = seconds([&] {
+            acc = parallel_accumulate(data.begin(), data.end(), acc_type(), exec);
+        });
+        single = (1 == threads) ? t : single;
+        std::cout << threads << " thread(s): " << t << " s  speedup " << single / t
+                  << "  first run " << cold << " s  (" << acc << ")\n";
+    }
+
+    return 0;
+}
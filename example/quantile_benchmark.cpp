@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// quantile_benchmark.cpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Compares the accuracy and memory of the streaming quantile estimators on
+//  log-normally distributed samples, which look like request latencies in
+//  nanoseconds with a median of 100us.
+//  For each estimator it prints the bytes of samples and markers it keeps,
+//  the time per sample, and the error of the rank of its estimate of the
+//  median, the 99th and the 99.9th percentile.
+//
+//  usage: quantile_benchmark [samples]
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <boost/array.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/hdr_histogram.hpp>
+#include <boost/accumulators/statistics/kll.hpp>
+#include <boost/accumulators/statistics/tdigest.hpp>
+#include <boost/accumulators/statistics/extended_p_square_quantile.hpp>
+#include <boost/accumulators/statistics/tail_quantile.hpp>
+
+using namespace boost::accumulators;
+
+double const probabilities[] = {0.5, 0.99, 0.999};
+
+std::vector<double> sorted;
+
+// the fraction of the samples below x
+double rank(double x)
+{
+    return double(std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / sorted.size();
+}
+
+// push the samples into acc, then print how it did; bytes(acc) tells how
+// much memory the estimator holds
+template<typename Acc, typename Bytes>
+void report(std::string const &name, Acc &acc, std::vector<double> const &data, Bytes bytes)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        acc(data[i]);
+    }
+    double const ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout.width(24);
+    std::cout << std::left << name << std::right;
+    std::cout.width(10);
+    std::cout << bytes(acc);
+    std::cout.width(10);
+    std::cout << ns / data.size();
+    for(std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double const p = probabilities[i];
+        std::cout.width(12);
+        std::cout << std::fabs(rank(quantile(acc, quantile_probability = p)) - p);
+    }
+    std::cout << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const n = argc > 1 ? static_cast<std::size_t>(std::atof(argv[1])) : 1000000;
+
+    std::mt19937 gen(1);
+    std::lognormal_distribution<double> dist(std::log(100000.), 1.);
+    std::vector<double> data(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        data[i] = dist(gen);
+    }
+    sorted = data;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::cout << n << " samples; error is |rank(estimate) - p|\n"
+              << "estimator                   bytes  ns/sample       p=0.5      p=0.99     p=0.999\n";
+
+    for(std::size_t k = 50; k <= 400; k *= 2)
+    {
+        accumulator_set<double, stats<tag::kll_quantile> > acc(tag::kll::k = k);
+        report("kll k=" + std::to_string(k), acc, data, [](decltype(acc) const &a) {
+            return kll(a).size() * sizeof(double);
+        });
+    }
+
+    for(std::size_t k = 4; k <= 16; k *= 2)
+    {
+        accumulator_set<double, stats<tag::kll_quantile(relative_error)> > acc(tag::kll::k = k);
+        report("relative kll k=" + std::to_string(k), acc, data, [](decltype(acc) const &a) {
+            return relative_kll(a).size() * sizeof(double);
+        });
+    }
+
+    for(double delta = 50.; delta <= 200.; delta *= 2)
+    {
+        accumulator_set<double, stats<tag::tdigest_quantile> > acc(tag::tdigest::compression = delta);
+        report("tdigest delta=" + std::to_string(int(delta)), acc, data, [](decltype(acc) const &a) {
+            return tdigest(a).size() * 2 * sizeof(double);
+        });
+    }
+
+    for(int d = 2; d <= 3; ++d)
+    {
+        // one count per bucket, up to the bucket of the largest sample
+        accumulator_set<double, stats<tag::hdr_quantile> > acc(tag::hdr_histogram::significant_digits = d);
+        report("hdr_histogram digits=" + std::to_string(d), acc, data, [d](decltype(acc) const &) {
+            std::size_t const half = d == 2 ? 128 : 1024;
+            std::size_t buckets = 2 * half;
+            for(double v = sorted.back(); v >= 2 * half; v /= 2)
+            {
+                buckets += half;
+            }
+            return buckets * sizeof(std::size_t);
+        });
+    }
+
+    {
+        // the probabilities must be known up front; each costs four markers
+        boost::array<double, 3> probs = {{0.5, 0.99, 0.999}};
+        accumulator_set<double, stats<tag::extended_p_square_quantile> > acc(extended_p_square_probabilities = probs);
+        report("extended_p_square", acc, data, [&probs](decltype(acc) const &) {
+            return (probs.size() + 4 * (2 * probs.size() + 3)) * sizeof(double);
+        });
+    }
+
+    {
+        // only quantiles above 1 - cache_size / n can be answered, so the
+        // median needs half of the samples
+        std::size_t const c = n / 2 + 1;
+        accumulator_set<double, stats<tag::tail_quantile<right> > > acc(tag::tail<right>::cache_size = c);
+        report("tail_quantile n/2", acc, data, [c](decltype(acc) const &) {
+            return c * (sizeof(double) + sizeof(std::size_t));
+        });
+    }
+
+    return 0;
+}
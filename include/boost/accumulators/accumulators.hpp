@@ -16,7 +16,9 @@
 #include <boost/accumulators/framework/external.hpp>
 #include <boost/accumulators/framework/features.hpp>
 #include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/framework/parameters/weight.hpp>
 #include <boost/accumulators/framework/parameters/weights.hpp>
 #include <boost/accumulators/framework/accumulators/external_accumulator.hpp>
@@ -14,6 +14,8 @@
 #include <boost/mpl/fold.hpp>
 #include <boost/mpl/contains.hpp>
 #include <boost/mpl/empty_sequence.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/accumulators/framework/accumulator_concept.hpp>
 
 namespace boost { namespace accumulators
@@ -45,7 +47,14 @@ struct accumulator_base
     {
     }
 
+    // hidden if defined in derived classes. Only called when every
+    // accumulator in the set is range-aware; see accumulator_set::add_range.
+    detail::void_ add_range(dont_care)
+    {
+    }
+
     typedef mpl::false_ is_droppable;
+    typedef mpl::false_ is_range_aware;
 
     detail::void_ add_ref(dont_care)
     {
@@ -58,6 +67,18 @@ struct accumulator_base
     detail::void_ on_drop(dont_care)
     {
     }
+
+    // hidden if defined in derived classes. Accumulators that have no exact
+    // rule for combining two partial results cannot be merged.
+    template<typename Accumulator, typename Args>
+    detail::void_ merge(Accumulator const &, Args const &)
+    {
+        BOOST_MPL_ASSERT_MSG(
+            (is_same<Args, void>::value)
+          , THIS_ACCUMULATOR_DOES_NOT_SUPPORT_MERGING
+          , (Accumulator)
+        );
+    }
 };
 
 }} // namespace boost::accumulators
@@ -16,12 +16,20 @@
 #include <boost/mpl/protect.hpp>
 #include <boost/mpl/identity.hpp>
 #include <boost/mpl/is_sequence.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/placeholders.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_base_of.hpp>
 #include <boost/type_traits/remove_const.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/core/enable_if.hpp>
 #include <boost/parameter/is_argument_pack.hpp>
+#include <boost/parameter/are_tagged_arguments.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/repetition/enum_binary_params.hpp>
@@ -31,9 +39,12 @@
 #include <boost/accumulators/framework/accumulator_concept.hpp>
 #include <boost/accumulators/framework/parameters/accumulator.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/accumulators/external_accumulator.hpp>
 #include <boost/accumulators/framework/accumulators/droppable_accumulator.hpp>
 #include <boost/fusion/include/any.hpp>
+#include <boost/fusion/include/cons.hpp>
 #include <boost/fusion/include/find_if.hpp>
 #include <boost/fusion/include/for_each.hpp>
 #include <boost/fusion/include/filter_view.hpp>
@@ -76,6 +87,81 @@ namespace detail
         return accumulator_visitor<Args>(args);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // range_accumulator_visitor
+    //   hand a whole block of samples to each accumulator's add_range() hook
+    template<typename Args>
+    struct range_accumulator_visitor
+    {
+        explicit range_accumulator_visitor(Args const &a)
+          : args(a)
+        {
+        }
+
+        range_accumulator_visitor(range_accumulator_visitor const &other)
+          : args(other.args)
+        {
+        }
+
+        template<typename Accumulator>
+        void operator ()(Accumulator &accumulator) const
+        {
+            accumulator.add_range(this->args);
+        }
+
+    private:
+        BOOST_DELETED_FUNCTION(range_accumulator_visitor &operator =(range_accumulator_visitor const &))
+        Args const &args;
+    };
+
+    template<typename Args>
+    inline range_accumulator_visitor<Args> const make_range_accumulator_visitor(Args const &args)
+    {
+        return range_accumulator_visitor<Args>(args);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // is_range_aware
+    template<typename Accumulator>
+    struct is_range_aware
+      : Accumulator::is_range_aware
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // all_range_aware
+    //   A block of samples can only be handed to the accumulators at once if none
+    //   of them needs to observe the intermediate state of its dependencies.
+    template<typename Accumulators>
+    struct all_range_aware
+      : mpl::fold<
+            Accumulators
+          , mpl::true_
+          , mpl::and_<mpl::_1, is_range_aware<mpl::_2> >
+        >::type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // merge_accumulators
+    //   Merge in the reverse of the dependency order, so that each accumulator
+    //   still sees the unmerged state of its dependencies in both sets.
+    template<typename Args>
+    inline void merge_accumulators(fusion::nil_ &, fusion::nil_ const &, Args const &)
+    {
+    }
+
+    template<typename Car, typename Cdr, typename Args>
+    inline void merge_accumulators(
+        fusion::cons<Car, Cdr> &accumulators
+      , fusion::cons<Car, Cdr> const &that
+      , Args const &args
+    )
+    {
+        detail::merge_accumulators(accumulators.cdr, that.cdr, args);
+        accumulators.car.merge(that.car, args);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // accumulator_set_base
     struct accumulator_set_base
@@ -189,7 +275,7 @@ struct accumulator_set
     explicit accumulator_set(
         A1 const &a1
       , typename boost::enable_if<
-            parameter::is_argument_pack<A1>
+            parameter::are_tagged_arguments<A1>
           , detail::_enabler
         >::type = detail::_enabler()
     ) : accumulators(
@@ -205,6 +291,35 @@ struct accumulator_set
         );
     }
 
+    /// \overload
+    ///
+    /// \param a1 Optional list of named parameters to be passed to all the
+    ///        accumulators, such as the parameters of an enclosing accumulator_set
+    ///        with its accumulator left out
+    template<typename A1>
+    explicit accumulator_set(
+        A1 const &a1
+      , typename boost::enable_if<
+            mpl::and_<
+                parameter::is_argument_pack<A1>
+              , mpl::not_<parameter::are_tagged_arguments<A1> >
+            >
+          , detail::_enabler
+        >::type = detail::_enabler()
+    ) : accumulators(
+            detail::make_acc_list(
+                accumulators_mpl_vector()
+                // a named parameter added to a list goes in front of it
+              , (a1, boost::accumulators::accumulator = *this)
+            )
+        )
+    {
+        // Add-ref the Features that the user has specified
+        this->template visit_if<detail::contains_feature_of_<Features> >(
+            detail::make_add_ref_visitor(boost::accumulators::accumulator = *this)
+        );
+    }
+
     /// \overload
     ///
     /// \param a1 Optional sample parameter to be passed to all the accumulators
@@ -393,6 +508,62 @@ struct accumulator_set
     void operator ()(A1 const &a1, A2 const &a2, ...);
     #endif
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Block accumulation
+    ///
+    /// Accumulate every sample in [first, last). If all the accumulators in the
+    /// set are range-aware, each is handed the whole block at once through its
+    /// add_range() hook, with the block bound to the sample_range parameter.
+    /// Otherwise, the samples are pushed one at a time as if by operator().
+    ///
+    /// \param first The beginning of the block of samples
+    /// \param last The end of the block of samples
+    template<typename ForwardIterator>
+    void add_range(ForwardIterator first, ForwardIterator last)
+    {
+        this->add_range_(
+            first
+          , last
+          , typename detail::all_range_aware<accumulators_mpl_vector>::type()
+        );
+    }
+
+    /// \overload
+    ///
+    /// \param rng A Forward Range of samples
+    template<typename ForwardRange>
+    void add_range(ForwardRange const &rng)
+    {
+        this->add_range(boost::begin(rng), boost::end(rng));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Merging
+    ///
+    /// Combine the results accumulated by another set of the same type into this
+    /// one, as if all of its samples had also been pushed into this set. Every
+    /// accumulator must define a merge() member, or this fails to compile.
+    ///
+    /// \param that The accumulator_set to merge into this one
+    void merge(accumulator_set const &that)
+    {
+        if(this == &that)
+        {
+            accumulator_set const copy(that);
+            this->merge(copy);
+            return;
+        }
+
+        detail::merge_accumulators(
+            this->accumulators
+          , that.accumulators
+          , (
+                boost::accumulators::accumulator = *this
+              , boost::accumulators::merged_accumulator = that
+            )
+        );
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     /// Extraction
     template<typename Feature>
@@ -454,6 +625,28 @@ struct accumulator_set
 
 private:
 
+    template<typename ForwardIterator>
+    void add_range_(ForwardIterator first, ForwardIterator last, mpl::true_)
+    {
+        this->visit(
+            detail::make_range_accumulator_visitor(
+                (
+                    boost::accumulators::accumulator = *this
+                  , boost::accumulators::sample_range = boost::make_iterator_range(first, last)
+                )
+            )
+        );
+    }
+
+    template<typename ForwardIterator>
+    void add_range_(ForwardIterator first, ForwardIterator last, mpl::false_)
+    {
+        for(; first != last; ++first)
+        {
+            (*this)(*first);
+        }
+    }
+
     accumulators_type accumulators;
 };
 
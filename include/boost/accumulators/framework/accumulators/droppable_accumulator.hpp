@@ -135,6 +135,24 @@ namespace boost { namespace accumulators
             }
         }
 
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            if(!this->is_dropped())
+            {
+                this->Accumulator::add_range(args);
+            }
+        }
+
+        template<typename Args>
+        void merge(droppable_accumulator_base const &that, Args const &args)
+        {
+            if(!this->is_dropped())
+            {
+                this->Accumulator::merge(that, args);
+            }
+        }
+
         template<typename Args>
         void add_ref(Args const &)
         {
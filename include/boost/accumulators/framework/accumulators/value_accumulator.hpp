@@ -34,6 +34,9 @@ namespace impl
         {
         }
 
+        // set at construction, not accumulated; a set keeps its own when merged
+        void merge(dont_care, dont_care) {}
+
         result_type result(dont_care) const
         {
             return this->val;
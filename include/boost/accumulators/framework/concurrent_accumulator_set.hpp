@@ -0,0 +1,302 @@
+///////////////////////////////////////////////////////////////////////////////
+// concurrent_accumulator_set.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_FRAMEWORK_CONCURRENT_ACCUMULATOR_SET_HPP
+#define BOOST_ACCUMULATORS_FRAMEWORK_CONCURRENT_ACCUMULATOR_SET_HPP
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_MUTEX) && !defined(BOOST_NO_CXX11_HDR_ATOMIC) \
+ && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_THREAD_LOCAL) \
+ && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_SMART_PTR)
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/accumulator_set.hpp>
+
+/// Defined when concurrent_accumulator_set is available, which requires the
+/// C++11 threading facilities.
+#define BOOST_ACCUMULATORS_HAS_CONCURRENT_ACCUMULATOR_SET
+
+namespace boost { namespace accumulators
+{
+
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // concurrent_set_id
+    //   a number that is different for every concurrent_accumulator_set, never
+    //   0 and never reused
+    inline std::size_t concurrent_set_id()
+    {
+        static std::atomic<std::size_t> next(0);
+        return next.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    template<typename T>
+    struct is_iterator_range
+      : mpl::false_
+    {
+    };
+
+    template<typename Iterator>
+    struct is_iterator_range<iterator_range<Iterator> >
+      : mpl::true_
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // snapshot_range
+    //   a range into the storage of a merged accumulator_set, which it keeps
+    //   alive for as long as a copy of the range exists
+    template<typename AccumulatorSet, typename Range>
+    struct snapshot_range
+      : Range
+    {
+        snapshot_range(std::shared_ptr<AccumulatorSet const> const &snapshot, Range const &rng)
+          : Range(rng)
+          , snapshot_(snapshot)
+        {
+        }
+
+    private:
+        std::shared_ptr<AccumulatorSet const> snapshot_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // concurrent_result
+    //   the result of a feature extracted from a concurrent_accumulator_set:
+    //   ranges come with the merged set they point into, values are copied
+    template<typename AccumulatorSet, typename Feature>
+    struct concurrent_result
+    {
+        typedef typename AccumulatorSet::template apply<Feature>::type::result_type result_type;
+        typedef typename mpl::if_<
+            is_iterator_range<result_type>
+          , snapshot_range<AccumulatorSet, result_type>
+          , result_type
+        >::type type;
+    };
+
+    template<typename Feature, typename ConcurrentSet>
+    typename concurrent_result<typename ConcurrentSet::accumulator_set_type, Feature>::type
+    extract_snapshot_result(ConcurrentSet const &acc, mpl::false_)
+    {
+        return extract_result<Feature>(acc.snapshot());
+    }
+
+    template<typename Feature, typename ConcurrentSet>
+    typename concurrent_result<typename ConcurrentSet::accumulator_set_type, Feature>::type
+    extract_snapshot_result(ConcurrentSet const &acc, mpl::true_)
+    {
+        typedef typename ConcurrentSet::accumulator_set_type accumulator_set_type;
+        typedef concurrent_result<accumulator_set_type, Feature> result;
+        std::shared_ptr<accumulator_set_type const> const snapshot(
+            std::make_shared<accumulator_set_type>(acc.snapshot())
+        );
+        return snapshot_range<accumulator_set_type, typename result::result_type>(
+            snapshot
+          , extract_result<Feature>(*snapshot)
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief An accumulator_set that many threads can push samples into at once.
+///
+/// The samples are spread over a number of shards, each an accumulator_set of
+/// its own. Every thread sticks to one shard: the threads are numbered in the
+/// order they first push into the set, and go to the shards in turn. So as long
+/// as no more threads push into the set than it has shards, no two threads
+/// share one, and pushing a sample only takes a lock that no other thread is
+/// holding, on a cache line that no other thread is writing to. The numbers are
+/// not handed back when threads exit.
+///
+/// The shards are merged with accumulator_set::merge when a result is
+/// extracted, so every feature in the set must be mergeable. The merged set
+/// includes all samples whose push completed before the extraction began;
+/// samples pushed while it is in progress may or may not be included. The
+/// results that are ranges, such as tail or density, keep the merged set they
+/// point into alive for as long as they exist.
+template<typename Sample, typename Features, typename Weight = void>
+struct concurrent_accumulator_set
+  : detail::accumulator_set_base
+{
+    typedef Sample sample_type;     ///< The type of the samples that will be accumulated
+    typedef Features features_type; ///< An MPL sequence of the features that should be accumulated.
+    typedef Weight weight_type;     ///< The type of the weight parameter. Must be a scalar. Defaults to void.
+
+    /// The type of each shard, and of the merged result
+    typedef accumulator_set<Sample, Features, Weight> accumulator_set_type;
+
+    /// \param shards The number of shards; 0 means one per hardware thread
+    explicit concurrent_accumulator_set(std::size_t shards = 0)
+      : prototype_()
+      , shards_()
+      , id_(detail::concurrent_set_id())
+      , slots_mutex_()
+      , slots_()
+    {
+        this->init(shards);
+    }
+
+    /// \param prototype The accumulator_set every shard starts from. It supplies
+    ///        the construction parameters and should not hold any samples yet.
+    /// \param shards The number of shards; 0 means one per hardware thread
+    explicit concurrent_accumulator_set(accumulator_set_type const &prototype, std::size_t shards = 0)
+      : prototype_(prototype)
+      , shards_()
+      , id_(detail::concurrent_set_id())
+      , slots_mutex_()
+      , slots_()
+    {
+        this->init(shards);
+    }
+
+    /// Accumulate a sample into the calling thread's shard. Takes the same
+    /// arguments as accumulator_set::operator().
+    template<typename... Args>
+    void operator ()(Args const &... args)
+    {
+        shard &s = this->local_shard();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.acc(args...);
+    }
+
+    /// Accumulate a block of samples into the calling thread's shard. Takes
+    /// the same arguments as accumulator_set::add_range().
+    template<typename... Args>
+    void add_range(Args const &... args)
+    {
+        shard &s = this->local_shard();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.acc.add_range(args...);
+    }
+
+    /// \return The results of all the shards, merged into one accumulator_set.
+    ///         Extract from it directly to pass extra parameters to a result()
+    ///         function, or to extract several results from the same samples.
+    accumulator_set_type snapshot() const
+    {
+        accumulator_set_type result(this->prototype_);
+        for(std::size_t i = 0; i < this->shards_.size(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(this->shards_[i]->mutex);
+            result.merge(this->shards_[i]->acc);
+        }
+        return result;
+    }
+
+    /// \return The number of shards
+    std::size_t shard_count() const
+    {
+        return this->shards_.size();
+    }
+
+    /// INTERNAL ONLY
+    ///
+    template<typename Feature>
+    struct apply
+    {
+        struct type
+        {
+            typedef typename detail::concurrent_result<accumulator_set_type, Feature>::type result_type;
+        };
+    };
+
+private:
+    BOOST_DELETED_FUNCTION(concurrent_accumulator_set(concurrent_accumulator_set const &))
+    BOOST_DELETED_FUNCTION(concurrent_accumulator_set &operator =(concurrent_accumulator_set const &))
+
+    struct shard
+    {
+        explicit shard(accumulator_set_type const &prototype)
+          : mutex()
+          , acc(prototype)
+        {
+        }
+
+        std::mutex mutex;
+        accumulator_set_type acc;
+        // keep the next shard off the cache lines this one writes to
+        char pad[64];
+    };
+
+    void init(std::size_t shards)
+    {
+        if(0 == shards)
+        {
+            shards = std::thread::hardware_concurrency();
+        }
+        shards = shards ? shards : 1;
+
+        this->shards_.reserve(shards);
+        for(std::size_t i = 0; i < shards; ++i)
+        {
+            this->shards_.push_back(std::unique_ptr<shard>(new shard(this->prototype_)));
+        }
+    }
+
+    shard &local_shard()
+    {
+        // the thread remembers its slot in the set it pushed into last, so it
+        // only looks it up again when it switches sets
+        static thread_local std::size_t cached_id = 0;
+        static thread_local std::size_t cached_slot = 0;
+        if(cached_id != this->id_)
+        {
+            cached_slot = this->slot();
+            cached_id = this->id_;
+        }
+        return *this->shards_[cached_slot % this->shards_.size()];
+    }
+
+    // the number of the calling thread in this set, handing out the next one
+    // if it has none yet
+    std::size_t slot()
+    {
+        std::lock_guard<std::mutex> lock(this->slots_mutex_);
+        std::size_t const next = this->slots_.size();
+        return this->slots_.insert(std::make_pair(std::this_thread::get_id(), next)).first->second;
+    }
+
+    accumulator_set_type prototype_;
+    std::vector<std::unique_ptr<shard> > shards_;
+    std::size_t const id_;
+    std::mutex slots_mutex_;
+    std::map<std::thread::id, std::size_t> slots_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// extract_result
+//   merge the shards and extract a result from the merged set
+template<typename Feature, typename Sample, typename Features, typename Weight>
+typename concurrent_accumulator_set<Sample, Features, Weight>::template apply<Feature>::type::result_type
+extract_result(concurrent_accumulator_set<Sample, Features, Weight> const &acc)
+{
+    typedef typename concurrent_accumulator_set<Sample, Features, Weight>::accumulator_set_type accumulator_set_type;
+    return detail::extract_snapshot_result<Feature>(
+        acc
+      , detail::is_iterator_range<typename accumulator_set_type::template apply<Feature>::type::result_type>()
+    );
+}
+
+}} // namespace boost::accumulators
+
+#endif
+
+#endif
@@ -0,0 +1,520 @@
+///////////////////////////////////////////////////////////////////////////////
+// parallel_accumulate.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_FRAMEWORK_PARALLEL_ACCUMULATE_HPP
+#define BOOST_ACCUMULATORS_FRAMEWORK_PARALLEL_ACCUMULATE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/accumulator_set.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_EXCEPTION) \
+ && !defined(BOOST_NO_CXX11_HDR_MUTEX) && !defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) && !defined(BOOST_NO_CXX11_SMART_PTR)
+# include <mutex>
+# include <memory>
+# include <atomic>
+# include <thread>
+# include <exception>
+# include <condition_variable>
+# define BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+#endif
+
+#ifndef BOOST_ACCUMULATORS_PARALLEL_CHUNK_BYTES
+  /// The size in bytes of the blocks of samples handed to the workers by
+  /// parallel_accumulate(). Defaults to 256 KiB, so that a block fits in a
+  /// typical per-core L2 cache.
+# define BOOST_ACCUMULATORS_PARALLEL_CHUNK_BYTES (256 * 1024)
+#endif
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// sequential_executor
+//   Runs every task on the calling thread.
+//
+//   An executor has a concurrency() member returning the number of workers W,
+//   and a function call operator taking a task and a number of jobs N. It must
+//   call task(worker, job) exactly once for each job in [0, N), with worker in
+//   [0, W). Calls with different workers may run concurrently; calls with the
+//   same worker must not.
+struct sequential_executor
+{
+    std::size_t concurrency() const
+    {
+        return 1;
+    }
+
+    template<typename Task>
+    void operator ()(Task &task, std::size_t size) const
+    {
+        for(std::size_t job = 0; job < size; ++job)
+        {
+            task(0, job);
+        }
+    }
+};
+
+#ifdef BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // thread_executor_worker
+    //   claims jobs until there are none left
+    template<typename Task>
+    struct thread_executor_worker
+    {
+        thread_executor_worker(Task &task, std::size_t worker, std::size_t size, std::atomic<std::size_t> &next, std::exception_ptr &error)
+          : task_(&task)
+          , worker_(worker)
+          , size_(size)
+          , next_(&next)
+          , error_(&error)
+        {
+        }
+
+        void operator ()() const
+        {
+            try
+            {
+                for(std::size_t job; (job = this->next_->fetch_add(1)) < this->size_;)
+                {
+                    (*this->task_)(this->worker_, job);
+                }
+            }
+            catch(...)
+            {
+                *this->error_ = std::current_exception();
+                // stop the other workers claiming further jobs
+                this->next_->store(this->size_);
+            }
+        }
+
+    private:
+        Task *task_;
+        std::size_t worker_;
+        std::size_t size_;
+        std::atomic<std::size_t> *next_;
+        std::exception_ptr *error_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // thread_pool
+    //   threads that wait for the next call of run() and call its job with their
+    //   worker number, 1 to size(), while the calling thread calls it with 0
+    struct thread_pool
+    {
+        explicit thread_pool(std::size_t helpers)
+          : helpers_(helpers)
+          , job_(0)
+          , context_(0)
+          , generation_(0)
+          , busy_(0)
+          , stop_(false)
+        {
+        }
+
+        ~thread_pool()
+        {
+            this->stop();
+        }
+
+        std::size_t size() const
+        {
+            return this->helpers_;
+        }
+
+        // job must not throw; one call runs at a time
+        void run(void (*job)(void *, std::size_t), void *context)
+        {
+            std::lock_guard<std::mutex> call(this->call_mutex_);
+            this->start();
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->job_ = job;
+                this->context_ = context;
+                this->busy_ = this->threads_.size();
+                ++this->generation_;
+            }
+            this->wake_.notify_all();
+
+            job(context, 0);
+
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            while(0 != this->busy_)
+            {
+                this->done_.wait(lock);
+            }
+        }
+
+    private:
+        BOOST_DELETED_FUNCTION(thread_pool(thread_pool const &))
+        BOOST_DELETED_FUNCTION(thread_pool &operator =(thread_pool const &))
+
+        // the threads start on the first call, so that an unused executor costs nothing
+        void start()
+        {
+            if(!this->threads_.empty() || 0 == this->helpers_)
+            {
+                return;
+            }
+            try
+            {
+                this->threads_.reserve(this->helpers_);
+                for(std::size_t worker = 1; worker <= this->helpers_; ++worker)
+                {
+                    this->threads_.push_back(std::thread(&thread_pool::loop, this, worker));
+                }
+            }
+            catch(...)
+            {
+                // could not start a thread; stop and join the ones that did start
+                this->stop();
+                this->stop_ = false;
+                throw;
+            }
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->stop_ = true;
+            }
+            this->wake_.notify_all();
+            for(std::size_t i = 0; i < this->threads_.size(); ++i)
+            {
+                this->threads_[i].join();
+            }
+            this->threads_.clear();
+        }
+
+        void loop(std::size_t worker)
+        {
+            std::size_t seen = 0;
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            for(;;)
+            {
+                while(!this->stop_ && seen == this->generation_)
+                {
+                    this->wake_.wait(lock);
+                }
+                if(this->stop_)
+                {
+                    return;
+                }
+                seen = this->generation_;
+                void (*job)(void *, std::size_t) = this->job_;
+                void *context = this->context_;
+
+                lock.unlock();
+                job(context, worker);
+                lock.lock();
+
+                if(0 == --this->busy_)
+                {
+                    this->done_.notify_one();
+                }
+            }
+        }
+
+        std::size_t helpers_;
+        std::vector<std::thread> threads_;
+        std::mutex call_mutex_;             // held for the whole of a call of run()
+        std::mutex mutex_;                  // guards the members below
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        void (*job_)(void *, std::size_t);
+        void *context_;
+        std::size_t generation_;            // the number of calls of run() so far
+        std::size_t busy_;                  // the threads still running the job
+        bool stop_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // thread_executor_call
+    //   the state of one call of thread_executor shared by its workers
+    template<typename Task>
+    struct thread_executor_call
+    {
+        thread_executor_call(Task &task, std::size_t size, std::size_t threads)
+          : task(task)
+          , size(size)
+          , threads(threads)
+          , next(0)
+          , errors(threads)
+        {
+        }
+
+        static void run(void *context, std::size_t worker)
+        {
+            thread_executor_call &call = *static_cast<thread_executor_call *>(context);
+            if(worker < call.threads)
+            {
+                thread_executor_worker<Task>(call.task, worker, call.size, call.next, call.errors[worker])();
+            }
+        }
+
+        Task &task;
+        std::size_t size;
+        std::size_t threads;
+        std::atomic<std::size_t> next;
+        std::vector<std::exception_ptr> errors;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// thread_executor
+//   Runs tasks on a pool of std::threads, one of which is the calling thread.
+//   The threads are started by the first call and wait for the next one in
+//   between, until the executor and all its copies are destroyed; so keep an
+//   executor around to save starting threads on each call. Calls from several
+//   threads take turns, and a task must not call the executor running it.
+//   Each idle worker claims the next unstarted job, so workers that are slowed
+//   down or descheduled simply end up doing fewer jobs. The first exception
+//   thrown by a task is rethrown on the calling thread once all workers have
+//   stopped.
+struct thread_executor
+{
+    /// \param threads The number of workers; 0 means one per hardware thread
+    explicit thread_executor(std::size_t threads = 0)
+    {
+        if(0 == threads)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+        if(0 == threads)
+        {
+            threads = 1;
+        }
+        this->pool_ = std::make_shared<detail::thread_pool>(threads - 1);
+    }
+
+    std::size_t concurrency() const
+    {
+        return this->pool_->size() + 1;
+    }
+
+    template<typename Task>
+    void operator ()(Task &task, std::size_t size) const
+    {
+        typedef detail::thread_executor_call<Task> call_type;
+
+        std::size_t const threads = size < this->concurrency() ? size : this->concurrency();
+        if(0 == threads)
+        {
+            return;
+        }
+
+        call_type call(task, size, threads);
+        if(1 == threads)
+        {
+            call_type::run(&call, 0);
+        }
+        else
+        {
+            this->pool_->run(&call_type::run, &call);
+        }
+
+        for(std::size_t i = 0; i < call.errors.size(); ++i)
+        {
+            if(call.errors[i])
+            {
+                std::rethrow_exception(call.errors[i]);
+            }
+        }
+    }
+
+private:
+    std::shared_ptr<detail::thread_pool> pool_;
+};
+
+typedef thread_executor default_executor;
+
+#else
+
+typedef sequential_executor default_executor;
+
+#endif
+
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // padded_accumulator_set
+    //   keeps the accumulator sets of different workers on different cache lines
+    template<typename AccumulatorSet>
+    struct padded_accumulator_set
+    {
+        explicit padded_accumulator_set(AccumulatorSet const &prototype)
+          : acc(prototype)
+        {
+        }
+
+        AccumulatorSet acc;
+        char pad[64];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // parallel_accumulate_task
+    //   job i accumulates the i-th chunk of the range into its worker's set
+    template<typename AccumulatorSet, typename RandomAccessIterator>
+    struct parallel_accumulate_task
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+        parallel_accumulate_task(
+            RandomAccessIterator first
+          , difference_type size
+          , difference_type chunk_size
+          , std::vector<padded_accumulator_set<AccumulatorSet> > &partials
+        )
+          : first_(first)
+          , size_(size)
+          , chunk_size_(chunk_size)
+          , partials_(partials)
+        {
+        }
+
+        void operator ()(std::size_t worker, std::size_t job) const
+        {
+            difference_type const begin = static_cast<difference_type>(job) * this->chunk_size_;
+            difference_type const end = (this->size_ - begin < this->chunk_size_) ? this->size_ : begin + this->chunk_size_;
+            this->partials_[worker].acc.add_range(this->first_ + begin, this->first_ + end);
+        }
+
+    private:
+        BOOST_DELETED_FUNCTION(parallel_accumulate_task &operator =(parallel_accumulate_task const &))
+
+        RandomAccessIterator first_;
+        difference_type size_;
+        difference_type chunk_size_;
+        std::vector<padded_accumulator_set<AccumulatorSet> > &partials_;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Accumulates the samples in [first, last) on the workers of an executor.
+///
+/// The range is split into chunks of \c chunk_size samples. Each worker feeds
+/// the chunks it claims into its own copy of \c prototype with
+/// accumulator_set::add_range, and the copies are then merged pairwise, as a
+/// tree, with accumulator_set::merge. So every feature in the set must be
+/// mergeable. \c prototype supplies the construction parameters of the sets
+/// and should not hold any samples yet, since every copy would count them.
+///
+/// The chunks may be claimed by different workers from one run to the next,
+/// so floating-point sums can differ in the last few bits between runs.
+///
+/// \param first The beginning of a random access range of samples
+/// \param last The end of the range
+/// \param prototype The accumulator_set each worker starts from
+/// \param exec The executor that runs the workers
+/// \param chunk_size The number of samples in a chunk; 0 means the number that
+///        fits in BOOST_ACCUMULATORS_PARALLEL_CHUNK_BYTES
+/// \return The merged results of all the workers
+template<typename AccumulatorSet, typename RandomAccessIterator, typename Executor>
+AccumulatorSet parallel_accumulate(
+    RandomAccessIterator first
+  , RandomAccessIterator last
+  , AccumulatorSet const &prototype
+  , Executor const &exec
+  , std::size_t chunk_size
+)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+    typedef detail::padded_accumulator_set<AccumulatorSet> padded_type;
+
+    if(0 == chunk_size)
+    {
+        chunk_size = BOOST_ACCUMULATORS_PARALLEL_CHUNK_BYTES / sizeof(value_type);
+        chunk_size = chunk_size ? chunk_size : 1;
+    }
+
+    difference_type const size = last - first;
+    BOOST_ASSERT(0 <= size);
+    std::size_t const jobs = (static_cast<std::size_t>(size) + chunk_size - 1) / chunk_size;
+    std::size_t workers = exec.concurrency();
+    workers = jobs < workers ? jobs : workers;
+
+    if(workers <= 1)
+    {
+        AccumulatorSet acc(prototype);
+        acc.add_range(first, last);
+        return acc;
+    }
+
+    std::vector<padded_type> partials;
+    partials.reserve(workers);
+    for(std::size_t i = 0; i < workers; ++i)
+    {
+        partials.push_back(padded_type(prototype));
+    }
+
+    detail::parallel_accumulate_task<AccumulatorSet, RandomAccessIterator> task(
+        first
+      , size
+      , static_cast<difference_type>(chunk_size)
+      , partials
+    );
+    exec(task, jobs);
+
+    for(std::size_t stride = 1; stride < workers; stride *= 2)
+    {
+        for(std::size_t i = 0; i + stride < workers; i += 2 * stride)
+        {
+            partials[i].acc.merge(partials[i + stride].acc);
+        }
+    }
+
+    return partials[0].acc;
+}
+
+/// \overload
+///
+template<typename AccumulatorSet, typename RandomAccessIterator, typename Executor>
+AccumulatorSet parallel_accumulate(
+    RandomAccessIterator first
+  , RandomAccessIterator last
+  , AccumulatorSet const &prototype
+  , Executor const &exec
+)
+{
+    return accumulators::parallel_accumulate(first, last, prototype, exec, 0);
+}
+
+/// \overload
+///
+template<typename AccumulatorSet, typename RandomAccessIterator>
+AccumulatorSet parallel_accumulate(
+    RandomAccessIterator first
+  , RandomAccessIterator last
+  , AccumulatorSet const &prototype
+)
+{
+    return accumulators::parallel_accumulate(first, last, prototype, default_executor(), 0);
+}
+
+/// \overload
+///
+template<typename AccumulatorSet, typename RandomAccessIterator>
+AccumulatorSet parallel_accumulate(
+    RandomAccessIterator first
+  , RandomAccessIterator last
+)
+{
+    return accumulators::parallel_accumulate(first, last, AccumulatorSet(), default_executor(), 0);
+}
+
+}} // namespace boost::accumulators
+
+#endif
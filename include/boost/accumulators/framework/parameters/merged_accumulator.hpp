@@ -0,0 +1,24 @@
+///////////////////////////////////////////////////////////////////////////////
+// merged_accumulator.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_FRAMEWORK_PARAMETERS_MERGED_ACCUMULATOR_HPP
+#define BOOST_ACCUMULATORS_FRAMEWORK_PARAMETERS_MERGED_ACCUMULATOR_HPP
+
+#include <boost/parameter/name.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+
+namespace boost { namespace accumulators
+{
+
+// The accumulator_set whose results are being merged into the one bound to
+// the accumulator parameter; see accumulator_set::merge.
+BOOST_PARAMETER_NAME((merged_accumulator, tag) merged_accumulator)
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(merged_accumulator)
+
+}} // namespace boost::accumulators
+
+#endif
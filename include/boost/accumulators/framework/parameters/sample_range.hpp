@@ -0,0 +1,24 @@
+///////////////////////////////////////////////////////////////////////////////
+// sample_range.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_FRAMEWORK_PARAMETERS_SAMPLE_RANGE_HPP
+#define BOOST_ACCUMULATORS_FRAMEWORK_PARAMETERS_SAMPLE_RANGE_HPP
+
+#include <boost/parameter/name.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+
+namespace boost { namespace accumulators
+{
+
+// A contiguous block of samples, passed to the add_range() hook of
+// range-aware accumulators as a boost::iterator_range<>.
+BOOST_PARAMETER_NAME((sample_range, tag) sample_range)
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(sample_range)
+
+}} // namespace boost::accumulators
+
+#endif
@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+// bit_scan.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_NUMERIC_DETAIL_BIT_SCAN_HPP
+#define BOOST_ACCUMULATORS_NUMERIC_DETAIL_BIT_SCAN_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+
+#if defined(BOOST_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+# include <intrin.h>
+# pragma intrinsic(_BitScanReverse64)
+#endif
+
+namespace boost { namespace numeric { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // count_leading_zeros
+    //   the number of zero bits above the highest set bit of a 64-bit value;
+    //   x must not be zero
+    inline int count_leading_zeros(boost::uint64_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(x);
+#elif defined(BOOST_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return 63 - static_cast<int>(index);
+#else
+        int n = 0;
+        for(int shift = 32; shift != 0; shift >>= 1)
+        {
+            if(0 == (x >> (64 - shift - n)))
+            {
+                n += shift;
+            }
+        }
+        return n;
+#endif
+    }
+
+}}} // namespace boost::numeric::detail
+
+#endif
@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////
+// block_kernels.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_NUMERIC_DETAIL_BLOCK_KERNELS_HPP
+#define BOOST_ACCUMULATORS_NUMERIC_DETAIL_BLOCK_KERNELS_HPP
+
+#include <vector>
+#include <iterator>
+#include <cstddef>
+#include <boost/static_assert.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#ifndef BOOST_ACCUMULATORS_BLOCK_KERNEL_BYTES
+  /// The combined width in bytes of the independent partial results kept by
+  /// the block kernels. Must be a power of two. Defaults to 64, the width of
+  /// an AVX-512 register, or two AVX2 registers, or four SSE registers.
+# define BOOST_ACCUMULATORS_BLOCK_KERNEL_BYTES 64
+#endif
+
+namespace boost { namespace numeric { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // is_contiguous_iterator_of
+    //   iterators known to address a contiguous array of T
+    template<typename Iter, typename T>
+    struct is_contiguous_iterator_of
+      : mpl::or_<
+            is_same<Iter, T *>
+          , is_same<Iter, T const *>
+          , is_same<Iter, typename std::vector<T>::iterator>
+          , is_same<Iter, typename std::vector<T>::const_iterator>
+        >
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // has_block_kernel
+    //   whether a block of Samples addressed by Iter can be handed to the
+    //   multi-lane kernels below
+    template<typename Iter, typename Sample>
+    struct has_block_kernel
+      : mpl::and_<
+            is_floating_point<Sample>
+          , is_contiguous_iterator_of<Iter, Sample>
+        >
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // block_lanes
+    template<typename T>
+    struct block_lanes
+      : mpl::int_<
+            (BOOST_ACCUMULATORS_BLOCK_KERNEL_BYTES / sizeof(T) > 0)
+              ? BOOST_ACCUMULATORS_BLOCK_KERNEL_BYTES / sizeof(T)
+              : 1
+        >
+    {
+        BOOST_STATIC_ASSERT((0 == (block_lanes::value & (block_lanes::value - 1))));
+    };
+
+    template<typename T>
+    T lane_pow(T x, mpl::int_<1>)
+    {
+        return x;
+    }
+
+    template<typename T, int N>
+    T lane_pow(T x, mpl::int_<N>)
+    {
+        T y = lane_pow(x, mpl::int_<N/2>());
+        T z = y * y;
+        return (N % 2) ? (z * x) : z;
+    }
+
+    template<int N>
+    struct sum_of_powers_op
+    {
+        template<typename T>
+        void accumulate(T &acc, T x) const
+        {
+            acc += lane_pow(x, mpl::int_<N>());
+        }
+
+        template<typename T>
+        void combine(T &acc, T x) const
+        {
+            acc += x;
+        }
+    };
+
+    // Written as selects rather than branches so they map onto the minps/maxps
+    // family, with the same NaN behavior as numeric::min_assign/max_assign:
+    // a NaN sample never replaces the current extremum.
+    struct min_op
+    {
+        template<typename T>
+        void accumulate(T &acc, T x) const
+        {
+            acc = (x < acc) ? x : acc;
+        }
+
+        template<typename T>
+        void combine(T &acc, T x) const
+        {
+            this->accumulate(acc, x);
+        }
+    };
+
+    struct max_op
+    {
+        template<typename T>
+        void accumulate(T &acc, T x) const
+        {
+            acc = (x > acc) ? x : acc;
+        }
+
+        template<typename T>
+        void combine(T &acc, T x) const
+        {
+            this->accumulate(acc, x);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // block_reduce
+    //   Reduce [first, last) into init, keeping block_lanes<T> independent
+    //   partial results that are combined pairwise at the end. The lanes break
+    //   the loop-carried dependency on a single accumulator, so the inner loop
+    //   can be compiled to packed SSE/AVX/AVX-512 instructions, whichever the
+    //   target supports.
+    template<typename T, typename Op>
+    T block_reduce(T const *first, T const *last, T init, T identity, Op const &op)
+    {
+        static int const lanes = block_lanes<T>::value;
+        T acc[lanes];
+        for(int i = 0; i < lanes; ++i)
+        {
+            acc[i] = identity;
+        }
+
+        std::ptrdiff_t const size = last - first;
+        T const *const stop = first + (size - size % lanes);
+        for(; first != stop; first += lanes)
+        {
+            for(int i = 0; i < lanes; ++i)
+            {
+                op.accumulate(acc[i], first[i]);
+            }
+        }
+
+        for(; first != last; ++first)
+        {
+            op.accumulate(acc[0], *first);
+        }
+
+        for(int width = lanes / 2; width > 0; width /= 2)
+        {
+            for(int i = 0; i < width; ++i)
+            {
+                op.combine(acc[i], acc[i + width]);
+            }
+        }
+
+        op.combine(init, acc[0]);
+        return init;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // block_sum_of_powers
+    //   The partial sums are reassociated, so the result may differ from
+    //   sample-at-a-time summation in the last few bits. Both stay within the
+    //   usual n * epsilon * sum(|x^N|) error bound of recursive summation.
+    template<typename T, int N>
+    T block_sum_of_powers(T const *first, T const *last, T init, mpl::int_<N>)
+    {
+        return block_reduce(first, last, init, T(), sum_of_powers_op<N>());
+    }
+
+    template<typename T>
+    T block_sum(T const *first, T const *last, T init)
+    {
+        return block_sum_of_powers(first, last, init, mpl::int_<1>());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // block_min
+    // block_max
+    //   exact; the same value as the sample-at-a-time result
+    template<typename T>
+    T block_min(T const *first, T const *last, T init)
+    {
+        return block_reduce(first, last, init, init, min_op());
+    }
+
+    template<typename T>
+    T block_max(T const *first, T const *last, T init)
+    {
+        return block_reduce(first, last, init, init, max_op());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // block_data
+    //   the address of the first element of a non-empty contiguous block
+    template<typename Iter>
+    typename std::iterator_traits<Iter>::value_type const *block_data(Iter it)
+    {
+        return &*it;
+    }
+
+}}} // namespace boost::numeric::detail
+
+#endif
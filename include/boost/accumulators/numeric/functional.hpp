@@ -34,6 +34,10 @@
 # include <boost/accumulators/numeric/functional/valarray.hpp>
 #endif
 
+#ifdef BOOST_NUMERIC_FUNCTIONAL_STD_ARRAY_SUPPORT
+# include <boost/accumulators/numeric/functional/array.hpp>
+#endif
+
 #ifdef BOOST_NUMERIC_FUNCTIONAL_STD_COMPLEX_SUPPORT
 # include <boost/accumulators/numeric/functional/complex.hpp>
 #endif
@@ -0,0 +1,296 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file array.hpp
+///
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_NUMERIC_FUNCTIONAL_ARRAY_HPP
+#define BOOST_NUMERIC_FUNCTIONAL_ARRAY_HPP
+
+#ifdef BOOST_NUMERIC_FUNCTIONAL_HPP_INCLUDED
+# error Include this file before boost/accumulators/numeric/functional.hpp
+#endif
+
+#include <cstddef>
+#include <boost/array.hpp>
+#include <boost/config.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/typeof/typeof.hpp>
+#include <boost/accumulators/numeric/functional_fwd.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ARRAY
+# include <array>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// The operators and function objects below are defined once for each
+// fixed-size array template: boost::array and, where there is one,
+// std::array. The extent is a template parameter, so the element loops
+// have a constant trip count, which the compiler unrolls and vectorizes,
+// and no operation allocates.
+
+/// INTERNAL ONLY
+///
+#define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_BIN_OP(Array, Op, Name)                   \
+    template<typename Left, typename Right, std::size_t N>                              \
+    Array<typename functional::Name<Left, Right>::result_type, N>                       \
+    operator Op(Array<Left, N> const &left, Array<Right, N> const &right)               \
+    {                                                                                   \
+        Array<typename functional::Name<Left, Right>::result_type, N> result;           \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            result[i] = numeric::Name(left[i], right[i]);                               \
+        }                                                                               \
+        return result;                                                                  \
+    }                                                                                   \
+    /**/
+
+/// INTERNAL ONLY
+///
+#define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_SCALAR_OP(Array, Op, Name)                \
+    template<typename Left, typename Right, std::size_t N>                              \
+    typename lazy_enable_if<                                                            \
+        is_scalar<Right>                                                                \
+      , acc_detail::make_array<Array, functional::Name<Left, Right>, N>                 \
+    >::type                                                                             \
+    operator Op(Array<Left, N> const &left, Right const &right)                         \
+    {                                                                                   \
+        Array<typename functional::Name<Left, Right>::result_type, N> result;           \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            result[i] = numeric::Name(left[i], right);                                  \
+        }                                                                               \
+        return result;                                                                  \
+    }                                                                                   \
+    /**/
+
+/// INTERNAL ONLY
+///
+#define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_ASSIGN_OP(Array, Op, Name)                \
+    template<typename Left, typename Right, std::size_t N>                              \
+    Array<Left, N> &                                                                    \
+    operator Op(Array<Left, N> &left, Array<Right, N> const &right)                     \
+    {                                                                                   \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            numeric::Name(left[i], right[i]);                                           \
+        }                                                                               \
+        return left;                                                                    \
+    }                                                                                   \
+    template<typename Left, typename Right, std::size_t N>                              \
+    typename enable_if<is_scalar<Right>, Array<Left, N> &>::type                        \
+    operator Op(Array<Left, N> &left, Right const &right)                               \
+    {                                                                                   \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            numeric::Name(left[i], right);                                              \
+        }                                                                               \
+        return left;                                                                    \
+    }                                                                                   \
+    /**/
+
+/// INTERNAL ONLY
+///
+#define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_OPERATORS(Array)                          \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_BIN_OP(Array, +, plus)                        \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_BIN_OP(Array, -, minus)                       \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_BIN_OP(Array, *, multiplies)                  \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_BIN_OP(Array, /, divides)                     \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_SCALAR_OP(Array, *, multiplies)               \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_SCALAR_OP(Array, /, divides)                  \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_ASSIGN_OP(Array, +=, plus_assign)             \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_ASSIGN_OP(Array, -=, minus_assign)            \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_ASSIGN_OP(Array, *=, multiplies_assign)       \
+    BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_ASSIGN_OP(Array, /=, divides_assign)          \
+                                                                                        \
+    /* Handle Left * Array<Right, N> where Left is a scalar. */                         \
+    template<typename Left, typename Right, std::size_t N>                              \
+    typename lazy_enable_if<                                                            \
+        is_scalar<Left>                                                                 \
+      , acc_detail::make_array<Array, functional::multiplies<Left, Right>, N>           \
+    >::type                                                                             \
+    operator *(Left const &left, Array<Right, N> const &right)                          \
+    {                                                                                   \
+        Array<typename functional::multiplies<Left, Right>::result_type, N> result;     \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            result[i] = numeric::multiplies(left, right[i]);                            \
+        }                                                                               \
+        return result;                                                                  \
+    }                                                                                   \
+                                                                                        \
+    /* Handle -Array<Arg, N> */                                                         \
+    template<typename Arg, std::size_t N>                                               \
+    Array<typename functional::unary_minus<Arg>::result_type, N>                        \
+    operator -(Array<Arg, N> const &arg)                                                \
+    {                                                                                   \
+        Array<typename functional::unary_minus<Arg>::result_type, N> result;            \
+        for(std::size_t i = 0; i != N; ++i)                                             \
+        {                                                                               \
+            result[i] = numeric::unary_minus(arg[i]);                                   \
+        }                                                                               \
+        return result;                                                                  \
+    }                                                                                   \
+    /**/
+
+/// INTERNAL ONLY
+///
+#define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_TAG(Array)                                \
+    template<typename T, std::size_t N>                                                 \
+    struct tag<Array<T, N> >                                                            \
+    {                                                                                   \
+        typedef array_tag type;                                                         \
+    };                                                                                  \
+    /**/
+
+namespace boost { namespace numeric
+{
+    namespace operators
+    {
+        namespace acc_detail
+        {
+            template<template<typename, std::size_t> class Array, typename Fun, std::size_t N>
+            struct make_array
+            {
+                typedef Array<typename Fun::result_type, N> type;
+            };
+        }
+
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_OPERATORS(boost::array)
+
+    #ifndef BOOST_NO_CXX11_HDR_ARRAY
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_OPERATORS(std::array)
+    #endif
+    }
+
+    namespace functional
+    {
+        struct array_tag;
+
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_TAG(boost::array)
+
+    #ifndef BOOST_NO_CXX11_HDR_ARRAY
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_TAG(std::array)
+    #endif
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // element-wise min of fixed-size arrays
+        template<typename Left, typename Right>
+        struct min_assign<Left, Right, array_tag, array_tag>
+        {
+            typedef Left first_argument_type;
+            typedef Right second_argument_type;
+            typedef void result_type;
+
+            void operator ()(Left &left, Right &right) const
+            {
+                for(std::size_t i = 0, size = left.size(); i != size; ++i)
+                {
+                    if(numeric::less(right[i], left[i]))
+                    {
+                        left[i] = right[i];
+                    }
+                }
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // element-wise max of fixed-size arrays
+        template<typename Left, typename Right>
+        struct max_assign<Left, Right, array_tag, array_tag>
+        {
+            typedef Left first_argument_type;
+            typedef Right second_argument_type;
+            typedef void result_type;
+
+            void operator ()(Left &left, Right &right) const
+            {
+                for(std::size_t i = 0, size = left.size(); i != size; ++i)
+                {
+                    if(numeric::greater(right[i], left[i]))
+                    {
+                        left[i] = right[i];
+                    }
+                }
+            }
+        };
+
+        // partial specialization for fixed-size arrays.
+        template<typename Left, typename Right>
+        struct fdiv<Left, Right, array_tag, void>
+          : mpl::if_<
+                are_integral<typename Left::value_type, Right>
+              , divides<Left, double const>
+              , divides<Left, Right>
+            >::type
+        {};
+
+        // promote
+        template<typename To, typename From>
+        struct promote<To, From, array_tag, array_tag>
+        {
+            typedef From argument_type;
+            typedef To result_type;
+
+            To operator ()(From &arr) const
+            {
+                typename remove_const<To>::type res;
+                for(std::size_t i = 0, size = arr.size(); i != size; ++i)
+                {
+                    res[i] = numeric::promote<typename To::value_type>(arr[i]);
+                }
+                return res;
+            }
+        };
+
+        template<typename ToFrom>
+        struct promote<ToFrom, ToFrom, array_tag, array_tag>
+        {
+            typedef ToFrom argument_type;
+            typedef ToFrom result_type;
+
+            ToFrom &operator ()(ToFrom &tofrom) const
+            {
+                return tofrom;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // functional::as_min, functional::as_max, functional::as_zero and
+        // functional::as_one fill the array with the value for the first element
+    #define BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE(Name)                        \
+        template<typename T>                                                            \
+        struct Name<T, array_tag>                                                       \
+        {                                                                               \
+            typedef T argument_type;                                                    \
+            typedef typename remove_const<T>::type result_type;                         \
+                                                                                        \
+            result_type operator ()(T &arr) const                                       \
+            {                                                                           \
+                result_type res;                                                        \
+                res.fill(0 == arr.size() ? typename result_type::value_type() : numeric::Name(arr[0])); \
+                return res;                                                             \
+            }                                                                           \
+        };                                                                              \
+        /**/
+
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE(as_min)
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE(as_max)
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE(as_zero)
+        BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE(as_one)
+
+    #undef BOOST_NUMERIC_FUNCTIONAL_DEFINE_ARRAY_AS_VALUE
+
+    } // namespace functional
+
+}} // namespace boost::numeric
+
+#include BOOST_TYPEOF_INCREMENT_REGISTRATION_GROUP()
+
+BOOST_TYPEOF_REGISTER_TEMPLATE(boost::array, (typename)(BOOST_TYPEOF_INTEGRAL(std::size_t)))
+
+#endif
@@ -91,6 +91,68 @@ namespace boost { namespace numeric
             }
             return result;
         }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle valarray<Left> += valarray<Right> where Right != Left.
+        // std::valarray has the compound assignments for its own element type;
+        // these update in place when the element types differ.
+        template<typename Left, typename Right>
+        typename disable_if<is_same<Left, Right>, std::valarray<Left> &>::type
+        operator +=(std::valarray<Left> &left, std::valarray<Right> const &right)
+        {
+            BOOST_ASSERT(left.size() == right.size());
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::plus_assign(left[i], right[i]);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle valarray<Left> -= valarray<Right> where Right != Left.
+        template<typename Left, typename Right>
+        typename disable_if<is_same<Left, Right>, std::valarray<Left> &>::type
+        operator -=(std::valarray<Left> &left, std::valarray<Right> const &right)
+        {
+            BOOST_ASSERT(left.size() == right.size());
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::minus_assign(left[i], right[i]);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle valarray<Left> *= Right where Right is a scalar and Right != Left.
+        template<typename Left, typename Right>
+        typename enable_if<
+            mpl::and_<is_scalar<Right>, mpl::not_<is_same<Left, Right> > >
+          , std::valarray<Left> &
+        >::type
+        operator *=(std::valarray<Left> &left, Right const &right)
+        {
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::multiplies_assign(left[i], right);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle valarray<Left> /= Right where Right is a scalar and Right != Left.
+        template<typename Left, typename Right>
+        typename enable_if<
+            mpl::and_<is_scalar<Right>, mpl::not_<is_same<Left, Right> > >
+          , std::valarray<Left> &
+        >::type
+        operator /=(std::valarray<Left> &left, Right const &right)
+        {
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::divides_assign(left[i], right);
+            }
+            return left;
+        }
     }
 
     namespace functional
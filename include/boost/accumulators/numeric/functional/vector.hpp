@@ -152,10 +152,12 @@ namespace boost { namespace numeric
         }
 
         ///////////////////////////////////////////////////////////////////////////////
-        // Handle vector<Left> += vector<Left>
-        template<typename Left>
+        // Handle vector<Left> += vector<Right>.
+        // The compound assignments work in place, so accumulators can update
+        // their vector-valued state without allocating a vector per sample.
+        template<typename Left, typename Right>
         std::vector<Left> &
-        operator +=(std::vector<Left> &left, std::vector<Left> const &right)
+        operator +=(std::vector<Left> &left, std::vector<Right> const &right)
         {
             BOOST_ASSERT(left.size() == right.size());
             for(std::size_t i = 0, size = left.size(); i != size; ++i)
@@ -165,6 +167,74 @@ namespace boost { namespace numeric
             return left;
         }
 
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle vector<Left> -= vector<Right>
+        template<typename Left, typename Right>
+        std::vector<Left> &
+        operator -=(std::vector<Left> &left, std::vector<Right> const &right)
+        {
+            BOOST_ASSERT(left.size() == right.size());
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::minus_assign(left[i], right[i]);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle vector<Left> *= vector<Right>
+        template<typename Left, typename Right>
+        std::vector<Left> &
+        operator *=(std::vector<Left> &left, std::vector<Right> const &right)
+        {
+            BOOST_ASSERT(left.size() == right.size());
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::multiplies_assign(left[i], right[i]);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle vector<Left> *= Right where Right is a scalar.
+        template<typename Left, typename Right>
+        typename enable_if<is_scalar<Right>, std::vector<Left> &>::type
+        operator *=(std::vector<Left> &left, Right const &right)
+        {
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::multiplies_assign(left[i], right);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle vector<Left> /= vector<Right>
+        template<typename Left, typename Right>
+        std::vector<Left> &
+        operator /=(std::vector<Left> &left, std::vector<Right> const &right)
+        {
+            BOOST_ASSERT(left.size() == right.size());
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::divides_assign(left[i], right[i]);
+            }
+            return left;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Handle vector<Left> /= Right where Right is a scalar.
+        template<typename Left, typename Right>
+        typename enable_if<is_scalar<Right>, std::vector<Left> &>::type
+        operator /=(std::vector<Left> &left, Right const &right)
+        {
+            for(std::size_t i = 0, size = left.size(); i != size; ++i)
+            {
+                numeric::divides_assign(left[i], right);
+            }
+            return left;
+        }
+
         ///////////////////////////////////////////////////////////////////////////////
         // Handle -vector<Arg>
         template<typename Arg>
@@ -9,6 +9,10 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_HPP_EAN_01_17_2006
 #define BOOST_ACCUMULATORS_STATISTICS_HPP_EAN_01_17_2006
 
+#include <boost/accumulators/statistics/atomic_count.hpp>
+#include <boost/accumulators/statistics/atomic_max.hpp>
+#include <boost/accumulators/statistics/atomic_min.hpp>
+#include <boost/accumulators/statistics/atomic_sum.hpp>
 #include <boost/accumulators/statistics/count.hpp>
 #include <boost/accumulators/statistics/covariance.hpp>
 #include <boost/accumulators/statistics/density.hpp>
@@ -16,6 +20,8 @@
 #include <boost/accumulators/statistics/error_of_mean.hpp>
 #include <boost/accumulators/statistics/extended_p_square.hpp>
 #include <boost/accumulators/statistics/extended_p_square_quantile.hpp>
+#include <boost/accumulators/statistics/hdr_histogram.hpp>
+#include <boost/accumulators/statistics/kll.hpp>
 #include <boost/accumulators/statistics/kurtosis.hpp>
 #include <boost/accumulators/statistics/max.hpp>
 #include <boost/accumulators/statistics/mean.hpp>
@@ -36,6 +42,7 @@
 #include <boost/accumulators/statistics/tail_mean.hpp>
 #include <boost/accumulators/statistics/tail_variate.hpp>
 #include <boost/accumulators/statistics/tail_variate_means.hpp>
+#include <boost/accumulators/statistics/tdigest.hpp>
 #include <boost/accumulators/statistics/variance.hpp>
 #include <boost/accumulators/statistics/weighted_covariance.hpp>
 #include <boost/accumulators/statistics/weighted_density.hpp>
@@ -53,6 +60,7 @@
 #include <boost/accumulators/statistics/weighted_tail_quantile.hpp>
 #include <boost/accumulators/statistics/weighted_tail_mean.hpp>
 #include <boost/accumulators/statistics/weighted_tail_variate_means.hpp>
+#include <boost/accumulators/statistics/weighted_tdigest.hpp>
 #include <boost/accumulators/statistics/weighted_variance.hpp>
 #include <boost/accumulators/statistics/with_error.hpp>
 #include <boost/accumulators/statistics/parameters/quantile_probability.hpp>
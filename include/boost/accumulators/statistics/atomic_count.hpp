@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+// atomic_count.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ATOMIC_COUNT_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ATOMIC_COUNT_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <cstddef>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/always.hpp>
+#include <boost/range/distance.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // atomic_count_impl
+    //   a count that many threads can increment at once
+    struct atomic_count_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef std::size_t result_type;
+        typedef mpl::true_ is_range_aware;
+
+        atomic_count_impl(dont_care)
+          : cnt(0)
+        {
+        }
+
+        atomic_count_impl(atomic_count_impl const &that)
+          : cnt(that.cnt.load(std::memory_order_relaxed))
+        {
+        }
+
+        void operator ()(dont_care)
+        {
+            this->cnt.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->cnt.fetch_add(static_cast<std::size_t>(boost::distance(args[sample_range])), std::memory_order_relaxed);
+        }
+
+        void merge(atomic_count_impl const &that, dont_care)
+        {
+            this->cnt.fetch_add(that.cnt.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->cnt.load(std::memory_order_relaxed);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int /* file_version */)
+        {
+            std::size_t tmp = this->cnt.load(std::memory_order_relaxed);
+            ar & tmp;
+            this->cnt.store(tmp, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::size_t> cnt;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::atomic_count
+//
+namespace tag
+{
+    struct atomic_count
+      : depends_on<>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef mpl::always<accumulators::impl::atomic_count_impl> impl;
+    };
+}
+
+// for the purposes of feature-based dependency resolution,
+// atomic_count provides the same feature as count
+template<>
+struct feature_of<tag::atomic_count>
+  : feature_of<tag::count>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+// atomic_max.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ATOMIC_MAX_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ATOMIC_MAX_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // atomic_max_impl
+    //   the maximum of arithmetic samples, which many threads can update at once
+    template<typename Sample>
+    struct atomic_max_impl
+      : accumulator_base
+    {
+        BOOST_STATIC_ASSERT((is_arithmetic<Sample>::value));
+
+        // for boost::result_of
+        typedef Sample result_type;
+        typedef mpl::true_ is_range_aware;
+
+        template<typename Args>
+        atomic_max_impl(Args const &args)
+          : max_(numeric::as_min(args[sample | Sample()]))
+        {
+        }
+
+        atomic_max_impl(atomic_max_impl const &that)
+          : max_(that.max_.load(std::memory_order_relaxed))
+        {
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->update(args[sample]);
+        }
+
+        // find the maximum of the block locally, then publish it with a
+        // single atomic update
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->update(max_samples(boost::begin(args[sample_range]), boost::end(args[sample_range])));
+        }
+
+        void merge(atomic_max_impl const &that, dont_care)
+        {
+            this->update(that.max_.load(std::memory_order_relaxed));
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->max_.load(std::memory_order_relaxed);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int /* file_version */)
+        {
+            Sample tmp = this->max_.load(std::memory_order_relaxed);
+            ar & tmp;
+            this->max_.store(tmp, std::memory_order_relaxed);
+        }
+
+    private:
+        // as with numeric::max_assign, a NaN never replaces the current value
+        void update(Sample value)
+        {
+            Sample old = this->max_.load(std::memory_order_relaxed);
+            while(value > old && !this->max_.compare_exchange_weak(old, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        template<typename Iter>
+        static Sample max_samples(Iter first, Iter last)
+        {
+            return max_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        static Sample max_samples(Iter first, Iter last, mpl::true_)
+        {
+            Sample m = numeric::as_min(Sample());
+            if(first != last)
+            {
+                Sample const *data = numeric::detail::block_data(first);
+                m = numeric::detail::block_max(data, data + (last - first), m);
+            }
+            return m;
+        }
+
+        template<typename Iter>
+        static Sample max_samples(Iter first, Iter last, mpl::false_)
+        {
+            Sample m = numeric::as_min(Sample());
+            for(; first != last; ++first)
+            {
+                numeric::max_assign(m, *first);
+            }
+            return m;
+        }
+
+        std::atomic<Sample> max_;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::atomic_max
+//
+namespace tag
+{
+    struct atomic_max
+      : depends_on<>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::atomic_max_impl<mpl::_1> impl;
+    };
+}
+
+// for the purposes of feature-based dependency resolution,
+// atomic_max provides the same feature as max
+template<>
+struct feature_of<tag::atomic_max>
+  : feature_of<tag::max>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
+
+#endif
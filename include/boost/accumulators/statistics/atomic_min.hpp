@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+// atomic_min.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ATOMIC_MIN_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ATOMIC_MIN_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // atomic_min_impl
+    //   the minimum of arithmetic samples, which many threads can update at once
+    template<typename Sample>
+    struct atomic_min_impl
+      : accumulator_base
+    {
+        BOOST_STATIC_ASSERT((is_arithmetic<Sample>::value));
+
+        // for boost::result_of
+        typedef Sample result_type;
+        typedef mpl::true_ is_range_aware;
+
+        template<typename Args>
+        atomic_min_impl(Args const &args)
+          : min_(numeric::as_max(args[sample | Sample()]))
+        {
+        }
+
+        atomic_min_impl(atomic_min_impl const &that)
+          : min_(that.min_.load(std::memory_order_relaxed))
+        {
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->update(args[sample]);
+        }
+
+        // find the minimum of the block locally, then publish it with a
+        // single atomic update
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->update(min_samples(boost::begin(args[sample_range]), boost::end(args[sample_range])));
+        }
+
+        void merge(atomic_min_impl const &that, dont_care)
+        {
+            this->update(that.min_.load(std::memory_order_relaxed));
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->min_.load(std::memory_order_relaxed);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int /* file_version */)
+        {
+            Sample tmp = this->min_.load(std::memory_order_relaxed);
+            ar & tmp;
+            this->min_.store(tmp, std::memory_order_relaxed);
+        }
+
+    private:
+        // as with numeric::min_assign, a NaN never replaces the current value
+        void update(Sample value)
+        {
+            Sample old = this->min_.load(std::memory_order_relaxed);
+            while(value < old && !this->min_.compare_exchange_weak(old, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        template<typename Iter>
+        static Sample min_samples(Iter first, Iter last)
+        {
+            return min_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        static Sample min_samples(Iter first, Iter last, mpl::true_)
+        {
+            Sample m = numeric::as_max(Sample());
+            if(first != last)
+            {
+                Sample const *data = numeric::detail::block_data(first);
+                m = numeric::detail::block_min(data, data + (last - first), m);
+            }
+            return m;
+        }
+
+        template<typename Iter>
+        static Sample min_samples(Iter first, Iter last, mpl::false_)
+        {
+            Sample m = numeric::as_max(Sample());
+            for(; first != last; ++first)
+            {
+                numeric::min_assign(m, *first);
+            }
+            return m;
+        }
+
+        std::atomic<Sample> min_;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::atomic_min
+//
+namespace tag
+{
+    struct atomic_min
+      : depends_on<>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::atomic_min_impl<mpl::_1> impl;
+    };
+}
+
+// for the purposes of feature-based dependency resolution,
+// atomic_min provides the same feature as min
+template<>
+struct feature_of<tag::atomic_min>
+  : feature_of<tag::min>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
+
+#endif
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+// atomic_sum.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ATOMIC_SUM_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ATOMIC_SUM_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // atomic_sum_impl
+    //   a sum of arithmetic samples that many threads can add to at once
+    template<typename Sample>
+    struct atomic_sum_impl
+      : accumulator_base
+    {
+        BOOST_STATIC_ASSERT((is_arithmetic<Sample>::value));
+
+        // for boost::result_of
+        typedef Sample result_type;
+        typedef mpl::true_ is_range_aware;
+
+        template<typename Args>
+        atomic_sum_impl(Args const &args)
+          : sum(args[sample | Sample()])
+        {
+        }
+
+        atomic_sum_impl(atomic_sum_impl const &that)
+          : sum(that.sum.load(std::memory_order_relaxed))
+        {
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->add(args[sample]);
+        }
+
+        // sum the block locally, then publish it with a single atomic update
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->add(sum_samples(boost::begin(args[sample_range]), boost::end(args[sample_range])));
+        }
+
+        void merge(atomic_sum_impl const &that, dont_care)
+        {
+            this->add(that.sum.load(std::memory_order_relaxed));
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->sum.load(std::memory_order_relaxed);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int /* file_version */)
+        {
+            Sample tmp = this->sum.load(std::memory_order_relaxed);
+            ar & tmp;
+            this->sum.store(tmp, std::memory_order_relaxed);
+        }
+
+    private:
+        void add(Sample value)
+        {
+            this->add(value, is_integral<Sample>());
+        }
+
+        void add(Sample value, true_type)
+        {
+            this->sum.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        // std::atomic has no fetch_add for floating-point types before C++20
+        void add(Sample value, false_type)
+        {
+            Sample old = this->sum.load(std::memory_order_relaxed);
+            while(!this->sum.compare_exchange_weak(old, old + value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        template<typename Iter>
+        static Sample sum_samples(Iter first, Iter last)
+        {
+            return sum_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        static Sample sum_samples(Iter first, Iter last, mpl::true_)
+        {
+            if(first == last)
+            {
+                return Sample();
+            }
+            Sample const *data = numeric::detail::block_data(first);
+            return numeric::detail::block_sum(data, data + (last - first), Sample());
+        }
+
+        template<typename Iter>
+        static Sample sum_samples(Iter first, Iter last, mpl::false_)
+        {
+            Sample s = Sample();
+            for(; first != last; ++first)
+            {
+                s += *first;
+            }
+            return s;
+        }
+
+        std::atomic<Sample> sum;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::atomic_sum
+//
+namespace tag
+{
+    struct atomic_sum
+      : depends_on<>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::atomic_sum_impl<mpl::_1> impl;
+    };
+}
+
+// for the purposes of feature-based dependency resolution,
+// atomic_sum provides the same feature as sum
+template<>
+struct feature_of<tag::atomic_sum>
+  : feature_of<tag::sum>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
+
+#endif
@@ -8,10 +8,13 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_COUNT_HPP_EAN_28_10_2005
 #define BOOST_ACCUMULATORS_STATISTICS_COUNT_HPP_EAN_28_10_2005
 
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/always.hpp>
+#include <boost/range/distance.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 
 namespace boost { namespace accumulators
@@ -27,6 +30,7 @@ namespace impl
     {
         // for boost::result_of
         typedef std::size_t result_type;
+        typedef mpl::true_ is_range_aware;
 
         count_impl(dont_care)
           : cnt(0)
@@ -38,6 +42,17 @@ namespace impl
             ++this->cnt;
         }
 
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->cnt += static_cast<std::size_t>(boost::distance(args[sample_range]));
+        }
+
+        void merge(count_impl const &that, dont_care)
+        {
+            this->cnt += that.cnt;
+        }
+
         result_type result(dont_care) const
         {
             return this->cnt;
@@ -8,9 +8,12 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_COVARIANCE_HPP_DE_01_01_2006
 #define BOOST_ACCUMULATORS_STATISTICS_COVARIANCE_HPP_DE_01_01_2006
 
+#include <cmath>
 #include <vector>
 #include <limits>
 #include <numeric>
+#include <iterator>
+#include <algorithm>
 #include <functional>
 #include <complex>
 #include <boost/mpl/assert.hpp>
@@ -20,21 +23,26 @@
 #include <boost/mpl/placeholders.hpp>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
 #include <boost/type_traits/is_scalar.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
 #include <boost/accumulators/statistics/mean.hpp>
+#include <boost/serialization/vector.hpp>
 
 namespace boost { namespace numeric
 {
     namespace functional
     {
         struct std_vector_tag;
+        struct array_tag;
 
         ///////////////////////////////////////////////////////////////////////////////
         // functional::outer_product
@@ -74,6 +82,11 @@ namespace boost { namespace numeric
                 return result;
             }
         };
+
+        template<typename Left, typename Right>
+        struct outer_product<Left, Right, array_tag, array_tag>
+          : outer_product<Left, Right, std_vector_tag, std_vector_tag>
+        {};
     }
 
     namespace op
@@ -147,6 +160,31 @@ namespace impl
             }
         }
 
+        // The pairwise update of variance_impl::merge, with the outer product of
+        // the differences of the means in place of the squared difference.
+        template<typename Args>
+        void merge(covariance_impl const &that, Args const &args)
+        {
+            // count and the means are merged after this, so they are still unmerged
+            std::size_t cnt = count(args);
+            std::size_t that_cnt = count(args[merged_accumulator]);
+            if(0 == cnt)
+            {
+                this->cov_ = that.cov_;
+            }
+            else if(0 != that_cnt)
+            {
+                extractor<tag::mean_of_variates<VariateType, VariateTag> > const some_mean_of_variates = {};
+
+                double n = static_cast<double>(cnt + that_cnt);
+                this->cov_ = this->cov_*(cnt/n) + that.cov_*(that_cnt/n)
+                           + numeric::outer_product(
+                                 some_mean_of_variates(args[merged_accumulator]) - some_mean_of_variates(args)
+                               , mean(args[merged_accumulator]) - mean(args)
+                             ) * (cnt/n * (that_cnt/n));
+            }
+        }
+
         result_type result(dont_care) const
         {
             return this->cov_;
@@ -163,6 +201,280 @@ namespace impl
         result_type cov_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // packed_covariance_impl
+    //
+    /**
+        @brief Covariance matrix of vector-valued samples, in packed storage
+
+        The covariance matrix \f$\mathrm{Cov}(X,X)\f$ of samples \f$X\f$ that are vectors, such as
+        <tt>std::vector\<double\></tt>, of the same size \f$d\f$. Since the matrix is symmetric, only its upper
+        triangle is kept, row by row in a single array of \f$d(d+1)/2\f$ elements. It holds the co-moment matrix
+
+        \f[
+            C_n = \sum_{i=1}^n (X_i - \hat{\mu}_n)(X_i - \hat{\mu}_n)^T,
+        \f]
+
+        which, with \f$\delta = X_n - \hat{\mu}_{n-1}\f$, takes the rank-1 update
+
+        \f[
+            C_n = C_{n-1} + \frac{n-1}{n} \delta \delta^T
+        \f]
+
+        in place. The means are kept alongside, so after the first sample no memory is allocated. The co-moment
+        matrix is divided by \f$n\f$ only when the covariance is extracted, as a <tt>ublas::symmetric_matrix</tt>.
+        The result is the same as that of <tt>tag::covariance\<Sample, Tag\></tt> when the samples are passed as
+        their own variates.
+
+        A block of samples passed to <tt>accumulator_set::add_range()</tt> is taken \f$k\f$ samples at a time. The
+        deviations of the samples from their own mean are copied into a row-major \f$(k+1) \times d\f$ matrix
+        \f$D\f$, whose last row \f$\sqrt{n k / (n + k)} (\hat{\mu}_k - \hat{\mu}_n)\f$ corrects for the
+        difference of the means, and the co-moment matrix takes the symmetric rank-\f$k+1\f$ update
+        \f$C \mathrel{+}= D^T D\f$, a band of columns at a time so that the band of \f$D\f$ stays in cache.
+    */
+    template<typename Sample>
+    struct packed_covariance_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<typename Sample::value_type, std::size_t>::result_type float_type;
+        typedef std::vector<float_type> array_type;
+        // for boost::result_of
+        typedef numeric::ublas::symmetric_matrix<float_type, numeric::ublas::upper> result_type;
+        typedef mpl::true_ is_range_aware;
+
+        packed_covariance_impl(dont_care)
+          : mean_()
+          , delta_()
+          , comoment_()
+          , block_()
+        {
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            std::size_t cnt = count(args);
+            Sample const &x = args[sample];
+            std::size_t const d = this->mean_.size();
+
+            if (1 == cnt)
+            {
+                this->mean_.assign(x.size(), float_type());
+                this->delta_.resize(x.size());
+                this->comoment_.assign(x.size() * (x.size() + 1) / 2, float_type());
+                for (std::size_t i = 0; i < x.size(); ++i)
+                {
+                    this->mean_[i] = x[i];
+                }
+                return;
+            }
+
+            float_type const inverse_cnt = numeric::fdiv(float_type(1), cnt);
+            float_type const factor = (cnt - 1) * inverse_cnt;
+            for (std::size_t i = 0; i < d; ++i)
+            {
+                this->delta_[i] = x[i] - this->mean_[i];
+                this->mean_[i] += this->delta_[i] * inverse_cnt;
+            }
+
+            float_type const *delta = &this->delta_[0];
+            float_type *row = &this->comoment_[0];
+            for (std::size_t i = 0; i < d; ++i)
+            {
+                float_type const a = factor * delta[i];
+                for (std::size_t j = i; j < d; ++j)
+                {
+                    row[j - i] += a * delta[j];
+                }
+                row += d - i;
+            }
+        }
+
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]), count(args));
+        }
+
+        // The pairwise update of Chan, Golub and LeVeque, as in variance_impl::merge
+        template<typename Args>
+        void merge(packed_covariance_impl const &that, Args const &args)
+        {
+            // count is merged after this, so it is still unmerged
+            std::size_t cnt = count(args);
+            std::size_t that_cnt = count(args[merged_accumulator]);
+            if (0 == cnt)
+            {
+                this->mean_ = that.mean_;
+                this->delta_ = that.delta_;
+                this->comoment_ = that.comoment_;
+            }
+            else if (0 != that_cnt)
+            {
+                std::size_t const d = this->mean_.size();
+                float_type const n = static_cast<float_type>(cnt + that_cnt);
+                float_type const factor = cnt * (that_cnt / n);
+                for (std::size_t i = 0; i < d; ++i)
+                {
+                    this->delta_[i] = that.mean_[i] - this->mean_[i];
+                    this->mean_[i] += this->delta_[i] * (that_cnt / n);
+                }
+
+                std::size_t k = 0;
+                for (std::size_t i = 0; i < d; ++i)
+                {
+                    float_type const a = factor * this->delta_[i];
+                    for (std::size_t j = i; j < d; ++j, ++k)
+                    {
+                        this->comoment_[k] += that.comoment_[k] + a * this->delta_[j];
+                    }
+                }
+            }
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            std::size_t const d = this->mean_.size();
+            float_type const inverse_cnt = numeric::fdiv(float_type(1), (std::max)(count(args), std::size_t(1)));
+            result_type cov(d, d);
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < d; ++i)
+            {
+                for (std::size_t j = i; j < d; ++j, ++k)
+                {
+                    cov(i, j) = this->comoment_[k] * inverse_cnt;
+                }
+            }
+            return cov;
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & mean_;
+            ar & comoment_;
+            this->delta_.resize(this->mean_.size());
+        }
+
+    private:
+        // cnt is the number of samples including those in [first, last)
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, std::size_t cnt)
+        {
+            static std::size_t const block_rows = 32;
+
+            cnt -= static_cast<std::size_t>(std::distance(first, last));
+            if (first == last)
+            {
+                return;
+            }
+            if (0 == cnt)
+            {
+                std::size_t const size = (*first).size();
+                this->mean_.assign(size, float_type());
+                this->delta_.resize(size);
+                this->comoment_.assign(size * (size + 1) / 2, float_type());
+            }
+
+            std::size_t const d = this->mean_.size();
+            if (0 == d)
+            {
+                return;
+            }
+            this->block_.resize((block_rows + 1) * d);
+            float_type *block = &this->block_[0];
+            float_type *block_mean = &this->delta_[0];
+
+            while (first != last)
+            {
+                // copy up to block_rows samples and take their mean
+                std::size_t k = 0;
+                std::fill(block_mean, block_mean + d, float_type());
+                for (; k != block_rows && first != last; ++k, ++first)
+                {
+                    Sample const &x = *first;
+                    float_type *row = block + k * d;
+                    for (std::size_t j = 0; j < d; ++j)
+                    {
+                        row[j] = x[j];
+                        block_mean[j] += row[j];
+                    }
+                }
+
+                float_type const n = static_cast<float_type>(cnt + k);
+                float_type const inverse_k = numeric::fdiv(float_type(1), k);
+                float_type const correction = std::sqrt(cnt * (k / n));
+                float_type *last_row = block + k * d;
+                for (std::size_t j = 0; j < d; ++j)
+                {
+                    block_mean[j] *= inverse_k;
+                    last_row[j] = correction * (block_mean[j] - this->mean_[j]);
+                    this->mean_[j] += (block_mean[j] - this->mean_[j]) * (k / n);
+                }
+                for (std::size_t r = 0; r < k; ++r)
+                {
+                    float_type *row = block + r * d;
+                    for (std::size_t j = 0; j < d; ++j)
+                    {
+                        row[j] -= block_mean[j];
+                    }
+                }
+
+                this->rank_update(block, k + 1);
+                cnt += k;
+            }
+        }
+
+        // comoment_ += D^T D for the rows x d row-major matrix D, on the upper triangle
+        void rank_update(float_type const *block, std::size_t rows)
+        {
+            static std::size_t const band = 128;
+
+            std::size_t const d = this->mean_.size();
+            for (std::size_t band_begin = 0; band_begin < d; band_begin += band)
+            {
+                std::size_t const band_end = (std::min)(band_begin + band, d);
+                float_type *row = &this->comoment_[0];
+                for (std::size_t i = 0; i < band_end; ++i)
+                {
+                    // row[j - i] is the element (i, j)
+                    std::size_t const j_begin = (std::max)(i, band_begin);
+                    float_type *out = row - i;
+                    std::size_t r = 0;
+                    for (; r + 4 <= rows; r += 4)
+                    {
+                        float_type const *d0 = block + r * d;
+                        float_type const *d1 = d0 + d;
+                        float_type const *d2 = d1 + d;
+                        float_type const *d3 = d2 + d;
+                        float_type const a0 = d0[i], a1 = d1[i], a2 = d2[i], a3 = d3[i];
+                        for (std::size_t j = j_begin; j < band_end; ++j)
+                        {
+                            out[j] += a0 * d0[j] + a1 * d1[j] + a2 * d2[j] + a3 * d3[j];
+                        }
+                    }
+                    for (; r < rows; ++r)
+                    {
+                        float_type const *d0 = block + r * d;
+                        float_type const a0 = d0[i];
+                        for (std::size_t j = j_begin; j < band_end; ++j)
+                        {
+                            out[j] += a0 * d0[j];
+                        }
+                    }
+                    row += d - i;
+                }
+            }
+        }
+
+        array_type mean_;       // means of the samples
+        array_type delta_;      // scratch space for the difference to the mean
+        array_type comoment_;   // upper triangle of the co-moment matrix, row by row
+        array_type block_;      // scratch space for a block of samples
+    };
+
 } // namespace impl
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -181,6 +493,14 @@ namespace tag
       : depends_on<>
     {
     };
+
+    struct packed_covariance
+      : depends_on<count>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::packed_covariance_impl<mpl::_1> impl;
+    };
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -201,6 +521,14 @@ struct feature_of<tag::covariance<VariateType, VariateTag> >
 {
 };
 
+// for the purposes of feature-based dependency resolution,
+// packed_covariance provides the same feature as covariance
+template<>
+struct feature_of<tag::packed_covariance>
+  : feature_of<tag::abstract_covariance>
+{
+};
+
 // So that covariance can be automatically substituted with
 // weighted_covariance when the weight parameter is non-void.
 template<typename VariateType, typename VariateTag>
@@ -11,15 +11,19 @@
 
 #include <vector>
 #include <limits>
+#include <iterator>
+#include <algorithm>
 #include <functional>
 #include <boost/range.hpp>
 #include <boost/parameter/keyword.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/placeholders.hpp>
 #include <boost/accumulators/accumulators_fwd.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
@@ -40,6 +44,43 @@ BOOST_PARAMETER_NESTED_KEYWORD(tag, density_num_bins, num_bins)
 BOOST_ACCUMULATORS_IGNORE_GLOBAL(density_cache_size)
 BOOST_ACCUMULATORS_IGNORE_GLOBAL(density_num_bins)
 
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // uniform_bin_index
+    //  the bin of x among num_bins bins of width 1/inverse_bin_size starting at lower,
+    //  where bin 0 takes the underflow and bin num_bins + 1 the overflow and NaN.
+    //  There are no branches, so loops over it vectorize, but the result can be one
+    //  off at a bin boundary; see adjust_bin_index.
+    template<typename Sample, typename T>
+    inline std::size_t uniform_bin_index(Sample const &x, T lower, T inverse_bin_size, std::size_t num_bins)
+    {
+        T const top = static_cast<T>(num_bins + 1);
+        T t = (x - lower) * inverse_bin_size + 1.;
+        t = t < top ? t : top;
+        t = t < 0. ? 0. : t;
+        return static_cast<std::size_t>(t);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // adjust_bin_index
+    //  move the estimate i to the bin whose lower bound in bin_positions is the
+    //  last one not greater than x, as std::upper_bound would find
+    template<typename Array, typename Sample>
+    inline std::size_t adjust_bin_index(Array const &bin_positions, Sample const &x, std::size_t i)
+    {
+        while (i != 0 && x < bin_positions[i])
+        {
+            --i;
+        }
+        while (i + 1 != bin_positions.size() && !(x < bin_positions[i + 1]))
+        {
+            ++i;
+        }
+        return i;
+    }
+}
+
 namespace impl
 {
     ///////////////////////////////////////////////////////////////////////////////
@@ -56,6 +97,9 @@ namespace impl
         return, where each pair contains the position of the bin (lower bound) and the samples count (normalized with the
         total number of samples).
 
+        As the bins are of the same size, the bin of a sample is computed from its distance to the first bin in constant
+        time, and then checked against the bin positions, so that a sample on a bin boundary goes where a search would put it.
+
         @param  density_cache_size Number of first samples used to determine min and max.
         @param  density_num_bins Number of bins (two additional bins collect under- and overflow samples).
     */
@@ -68,6 +112,7 @@ namespace impl
         typedef std::vector<float_type> array_type;
         // for boost::result_of
         typedef iterator_range<typename histogram_type::iterator> result_type;
+        typedef mpl::true_ is_range_aware;
 
         template<typename Args>
         density_impl(Args const &args)
@@ -76,6 +121,7 @@ namespace impl
             , num_bins(args[density_num_bins])
             , samples_in_bin(num_bins + 2, 0.)
             , bin_positions(num_bins + 2)
+            , inverse_bin_size()
             , histogram(
                 num_bins + 2
               , std::make_pair(
@@ -98,71 +144,26 @@ namespace impl
             if (cnt <= this->cache_size)
             {
                 this->cache[cnt - 1] = args[sample];
-            }
 
-            // Once cache_size samples have been accumulated, create num_bins bins of same size between
-            // the minimum and maximum of the cached samples as well as under and overflow bins.
-            // Store their lower bounds (bin_positions) and fill the bins with the cached samples (samples_in_bin).
-            if (cnt == this->cache_size)
-            {
-                float_type minimum = numeric::fdiv((min)(args), (std::size_t)1);
-                float_type maximum = numeric::fdiv((max)(args), (std::size_t)1);
-                float_type bin_size = numeric::fdiv(maximum - minimum, this->num_bins );
-
-                // determine bin positions (their lower bounds)
-                for (std::size_t i = 0; i < this->num_bins + 2; ++i)
+                if (cnt == this->cache_size)
                 {
-                    this->bin_positions[i] = minimum + (i - 1.) * bin_size;
-                }
-
-                for (typename array_type::const_iterator iter = this->cache.begin(); iter != this->cache.end(); ++iter)
-                {
-                    if (*iter < this->bin_positions[1])
-                    {
-                        ++(this->samples_in_bin[0]);
-                    }
-                    else if (*iter >= this->bin_positions[this->num_bins + 1])
-                    {
-                        ++(this->samples_in_bin[this->num_bins + 1]);
-                    }
-                    else
-                    {
-                        typename array_type::iterator it = std::upper_bound(
-                            this->bin_positions.begin()
-                          , this->bin_positions.end()
-                          , *iter
-                        );
-
-                        std::size_t d = std::distance(this->bin_positions.begin(), it);
-                        ++(this->samples_in_bin[d - 1]);
-                    }
+                    this->make_bins();
                 }
             }
             // Add each subsequent sample to the correct bin
-            else if (cnt > this->cache_size)
+            else
             {
-                if (args[sample] < this->bin_positions[1])
-                {
-                    ++(this->samples_in_bin[0]);
-                }
-                else if (args[sample] >= this->bin_positions[this->num_bins + 1])
-                {
-                    ++(this->samples_in_bin[this->num_bins + 1]);
-                }
-                else
-                {
-                    typename array_type::iterator it = std::upper_bound(
-                        this->bin_positions.begin()
-                      , this->bin_positions.end()
-                      , args[sample]
-                    );
-
-                    std::size_t d = std::distance(this->bin_positions.begin(), it);
-                    ++(this->samples_in_bin[d - 1]);
-                }
+                ++(this->samples_in_bin[this->bin_of(args[sample])]);
             }
         }
 
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->is_dirty = true;
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]), count(args));
+        }
+
         /**
             @pre The number of samples must meet or exceed the cache size
         */
@@ -198,14 +199,331 @@ namespace impl
             ar & bin_positions;
             ar & histogram;
             ar & is_dirty; 
+            this->inverse_bin_size = numeric::fdiv(this->num_bins, this->bin_positions[this->num_bins + 1] - this->bin_positions[1]);
         }
 
     private:
+        // Once cache_size samples have been accumulated, create num_bins bins of same size between
+        // the minimum and maximum of the cached samples as well as under and overflow bins.
+        // Store their lower bounds (bin_positions) and fill the bins with the cached samples (samples_in_bin).
+        void make_bins()
+        {
+            float_type minimum = *std::min_element(this->cache.begin(), this->cache.end());
+            float_type maximum = *std::max_element(this->cache.begin(), this->cache.end());
+            float_type bin_size = numeric::fdiv(maximum - minimum, this->num_bins );
+
+            // determine bin positions (their lower bounds)
+            for (std::size_t i = 0; i < this->num_bins + 2; ++i)
+            {
+                this->bin_positions[i] = minimum + (i - 1.) * bin_size;
+            }
+            this->inverse_bin_size = numeric::fdiv(this->num_bins, maximum - minimum);
+
+            for (typename array_type::const_iterator iter = this->cache.begin(); iter != this->cache.end(); ++iter)
+            {
+                ++(this->samples_in_bin[this->bin_of(*iter)]);
+            }
+        }
+
+        template<typename T>
+        std::size_t bin_of(T const &x) const
+        {
+            std::size_t i = detail::uniform_bin_index(x, this->bin_positions[1], this->inverse_bin_size, this->num_bins);
+            return detail::adjust_bin_index(this->bin_positions, x, i);
+        }
+
+        // cnt is the number of samples including those in [first, last)
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, std::size_t cnt)
+        {
+            cnt -= static_cast<std::size_t>(std::distance(first, last));
+
+            for (; first != last && cnt < this->cache_size; ++first)
+            {
+                this->cache[cnt++] = *first;
+
+                if (cnt == this->cache_size)
+                {
+                    this->make_bins();
+                }
+            }
+
+            if (first == last)
+            {
+                return;
+            }
+
+            // the bins of a chunk of samples are computed in one loop, which
+            // the compiler can vectorize, and then checked and counted; the
+            // locals keep the stores to the bins from forcing reloads
+            static std::size_t const block_size = 256;
+            float_type values[block_size];
+            std::size_t bins[block_size];
+            float_type const lower = this->bin_positions[1];
+            float_type const inverse = this->inverse_bin_size;
+            std::size_t const inner_bins = this->num_bins;
+            array_type const &positions = this->bin_positions;
+            float_type *counts = &this->samples_in_bin[0];
+            while (first != last)
+            {
+                std::size_t n = 0;
+                for (; n != block_size && first != last; ++n, ++first)
+                {
+                    values[n] = *first;
+                }
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    bins[i] = detail::uniform_bin_index(values[i], lower, inverse, inner_bins);
+                }
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    ++counts[detail::adjust_bin_index(positions, values[i], bins[i])];
+                }
+            }
+        }
+
         std::size_t            cache_size;      // number of cached samples
         array_type             cache;           // cache to store the first cache_size samples
         std::size_t            num_bins;        // number of bins
         array_type             samples_in_bin;  // number of samples in each bin
         array_type             bin_positions;   // lower bounds of bins
+        float_type             inverse_bin_size; // num_bins over the width of the inner bins
+        mutable histogram_type histogram;       // histogram
+        mutable bool is_dirty;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // adaptive_density_impl
+    //  density histogram whose bins follow the range of the samples
+    /**
+        @brief Histogram density estimator with bins that widen as the range of the samples grows
+
+        As density_impl, the adaptive histogram density estimator returns num_bins bins of same size
+        between an under- and an overflow bin, but it does not cache samples to place its bins.
+        The first two distinct samples set the range of the bins. When a sample falls outside of
+        the range, the bins are doubled in width, by adding the counts of each pair of neighbouring
+        bins, and the range is extended on the side of the sample, until the sample falls inside
+        of it. As the new bins are unions of the old ones, the counts stay exact for the new bins,
+        and no sample is ever read again. The memory used is that of num_bins bins, whatever the
+        number of samples, and results are available from the second distinct sample on.
+
+        The bins do not narrow again, so a single outlier leaves the histogram with wide bins. The
+        under- and overflow bins collect the infinite samples, and the overflow bin collects NaN.
+        They also collect the finite samples so far apart from the others that the range of the
+        bins would overflow.
+
+        @param  density_num_bins Number of bins (two additional bins collect under- and overflow samples).
+    */
+    template<typename Sample>
+    struct adaptive_density_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef std::vector<std::pair<float_type, float_type> > histogram_type;
+        typedef std::vector<float_type> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename histogram_type::iterator> result_type;
+        typedef mpl::true_ is_range_aware;
+
+        template<typename Args>
+        adaptive_density_impl(Args const &args)
+            : num_bins(args[density_num_bins])
+            , samples_in_bin(num_bins + 2, 0.)
+            , bin_positions(num_bins + 2, 0.)
+            , bin_size(0.)
+            , inverse_bin_size(0.)
+            , histogram(
+                num_bins + 2
+              , std::make_pair(
+                    numeric::fdiv(args[sample | Sample()],(std::size_t)1)
+                  , numeric::fdiv(args[sample | Sample()],(std::size_t)1)
+                )
+              )
+            , is_dirty(true)
+        {
+            BOOST_ASSERT(0 < this->num_bins);
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->is_dirty = true;
+            this->add(args[sample]);
+        }
+
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->is_dirty = true;
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]));
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            if (this->is_dirty)
+            {
+                this->is_dirty = false;
+
+                for (std::size_t i = 0; i < this->num_bins + 2; ++i)
+                {
+                    this->histogram[i] = std::make_pair(this->bin_positions[i], numeric::fdiv(this->samples_in_bin[i], count(args)));
+                }
+            }
+            // returns a range of pairs
+            return make_iterator_range(this->histogram);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & num_bins;
+            ar & samples_in_bin;
+            ar & bin_positions;
+            ar & bin_size;
+            ar & histogram;
+            ar & is_dirty;
+            this->inverse_bin_size = 0. == this->bin_size ? 0. : numeric::fdiv(1., this->bin_size);
+        }
+
+    private:
+        template<typename Iter>
+        void add_samples(Iter first, Iter last)
+        {
+            for (; first != last; ++first)
+            {
+                this->add(*first);
+            }
+        }
+
+        template<typename T>
+        void add(T const &sample)
+        {
+            float_type x = sample;
+
+            // infinite samples and NaN would widen the bins forever
+            if (!is_finite(x))
+            {
+                ++(this->samples_in_bin[x < 0. ? 0 : this->num_bins + 1]);
+                return;
+            }
+
+            // Until the bins have a size, all the samples are the first one, in the first bin.
+            if (0. == this->bin_size)
+            {
+                if (0. == this->samples_in_bin[1])
+                {
+                    this->make_bins(x, 0.);
+                }
+                if (x == this->bin_positions[1])
+                {
+                    ++(this->samples_in_bin[1]);
+                    return;
+                }
+                if (!this->set_range(x))
+                {
+                    ++(this->samples_in_bin[x < this->bin_positions[1] ? 0 : this->num_bins + 1]);
+                    return;
+                }
+            }
+
+            while (x < this->bin_positions[1])
+            {
+                if (!this->widen_bins(true))
+                {
+                    ++(this->samples_in_bin[0]);
+                    return;
+                }
+            }
+            while (!(x < this->bin_positions[this->num_bins + 1]))
+            {
+                if (!this->widen_bins(false))
+                {
+                    ++(this->samples_in_bin[this->num_bins + 1]);
+                    return;
+                }
+            }
+            std::size_t i = detail::uniform_bin_index(x, this->bin_positions[1], this->inverse_bin_size, this->num_bins);
+            ++(this->samples_in_bin[detail::adjust_bin_index(this->bin_positions, x, i)]);
+        }
+
+        // The first sample and x, a different one, are placed in the first and last bins.
+        // Returns false, and leaves the bins alone, if their range would overflow or their
+        // size underflow.
+        bool set_range(float_type x)
+        {
+            float_type first = this->bin_positions[1];
+            float_type lower = x < first ? x : first;
+            float_type size = numeric::fdiv(x < first ? first - x : x - first, this->num_bins - 0.5);
+            if (!this->is_valid_range(lower, size))
+            {
+                return false;
+            }
+            if (x < first)
+            {
+                std::swap(this->samples_in_bin[1], this->samples_in_bin[this->num_bins]);
+            }
+            this->make_bins(lower, size);
+            return true;
+        }
+
+        // Adds each pair of bins into one of the bins of twice the size, which keeps the
+        // range of the bins in its upper half if the range is extended below, or in its lower
+        // half if it is extended above. The new bins start on boundaries of the old ones.
+        // Returns false, and leaves the bins alone, if their range would overflow.
+        bool widen_bins(bool below)
+        {
+            float_type lower = below ? this->bin_positions[1] - this->num_bins * this->bin_size : this->bin_positions[1];
+            float_type size = 2. * this->bin_size;
+            if (!this->is_valid_range(lower, size))
+            {
+                return false;
+            }
+
+            std::size_t offset = below ? this->num_bins : 0;
+            array_type counts(this->num_bins + 2, 0.);
+            counts.front() = this->samples_in_bin.front();
+            counts.back() = this->samples_in_bin.back();
+            for (std::size_t i = 0; i < this->num_bins; ++i)
+            {
+                counts[1 + (offset + i) / 2] += this->samples_in_bin[1 + i];
+            }
+            this->samples_in_bin.swap(counts);
+            this->make_bins(lower, size);
+            return true;
+        }
+
+        // the bins starting at lower, their bounds and their width are all finite, and the
+        // size is large enough for the bounds to separate; a size that underflows would
+        // leave every bound equal to lower, and widening such bins would never end
+        bool is_valid_range(float_type lower, float_type size) const
+        {
+            float_type width = this->num_bins * size;
+            return 0. < size && lower + size != lower
+                && is_finite(lower) && is_finite(width) && is_finite(lower + width);
+        }
+
+        static bool is_finite(float_type x)
+        {
+            return x - x == x - x;
+        }
+
+        void make_bins(float_type lower, float_type size)
+        {
+            for (std::size_t i = 0; i < this->num_bins + 2; ++i)
+            {
+                this->bin_positions[i] = lower + (i - 1.) * size;
+            }
+            this->bin_size = size;
+            this->inverse_bin_size = 0. == size ? 0. : numeric::fdiv(1., size);
+        }
+
+        std::size_t            num_bins;        // number of bins
+        array_type             samples_in_bin;  // number of samples in each bin
+        array_type             bin_positions;   // lower bounds of bins
+        float_type             bin_size;        // 0 until two distinct samples were seen
+        float_type             inverse_bin_size; // one over bin_size
         mutable histogram_type histogram;       // histogram
         mutable bool is_dirty;
     };
@@ -233,6 +551,20 @@ namespace tag
         static boost::parameter::keyword<density_num_bins> const num_bins;
         #endif
     };
+
+    struct adaptive_density
+      : depends_on<count>
+      , density_num_bins
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::adaptive_density_impl<mpl::_1> impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::density::num_bins named parameter
+        static boost::parameter::keyword<density_num_bins> const num_bins;
+        #endif
+    };
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -261,6 +593,14 @@ struct feature_of<tag::weighted_density>
 {
 };
 
+// for the purposes of feature-based dependency resolution,
+// adaptive_density provides the same feature as density
+template<>
+struct feature_of<tag::adaptive_density>
+  : feature_of<tag::density>
+{
+};
+
 }} // namespace boost::accumulators
 
 #endif
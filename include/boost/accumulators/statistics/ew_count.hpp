@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////
+// ew_count.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_EW_COUNT_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_EW_COUNT_HPP
+
+#include <stdexcept>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/config/no_tr1/cmath.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/timestamp.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::ew_alpha::alpha named parameter
+// tag::ew_half_life::half_life named parameter
+BOOST_PARAMETER_NESTED_KEYWORD(tag, ew_alpha, alpha)
+BOOST_PARAMETER_NESTED_KEYWORD(tag, ew_half_life, half_life)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(ew_alpha)
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(ew_half_life)
+
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ew_decay_rate
+    //    the rate r such that the weight of a sample decays by exp(-r) per sample,
+    //    or per unit of time, from the smoothing factor alpha if it is given, or
+    //    else from the half-life
+    template<typename Args>
+    double ew_decay_rate(Args const &args)
+    {
+        double const alpha = args[ew_alpha | 0.];
+        if(0. != alpha)
+        {
+            if(!(0. < alpha && alpha <= 1.))
+            {
+                boost::throw_exception(std::invalid_argument("the smoothing factor alpha must be in (0, 1]"));
+            }
+            return -std::log(1. - alpha);
+        }
+        double const half_life = args[ew_half_life | 0.];
+        if(!(0. < half_life))
+        {
+            boost::throw_exception(std::invalid_argument("either alpha or a positive half-life must be given"));
+        }
+        return std::log(2.) / half_life;
+    }
+}
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ew_count_impl
+    //    the sum of the weights of the samples, which decay exponentially with
+    //    the number of samples that followed them
+    /**
+        @brief Exponentially weighted count
+
+        The weight of a sample is \f$(1-\alpha)^k\f$ after \f$k\f$ later samples, so the
+        exponentially weighted count
+
+        \f[
+            S_n = (1-\alpha) S_{n-1} + 1, \quad S_0 = 0,
+        \f]
+
+        is the effective number of samples that the exponentially weighted statistics are
+        computed from. It tends to \f$1/\alpha\f$. The decay \f$1-\alpha\f$ applied by the
+        latest update is shared with the statistics that depend on this one.
+
+        @param ew_alpha The smoothing factor \f$\alpha\f$, in \f$(0,1]\f$
+        @param ew_half_life The number of samples \f$h\f$ after which the weight of a sample
+               halves, if \f$\alpha\f$ is not given, so that \f$1-\alpha = 2^{-1/h}\f$
+    */
+    template<typename Sample>
+    struct ew_count_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef double result_type;
+
+        template<typename Args>
+        ew_count_impl(Args const &args)
+          : decay_(std::exp(-detail::ew_decay_rate(args)))
+          , sum_(0.)
+        {}
+
+        void operator ()(dont_care)
+        {
+            this->sum_ = this->sum_ * this->decay_ + 1.;
+        }
+
+        // the factor the weights of the earlier samples were multiplied
+        // by when the latest sample was added
+        double decay() const
+        {
+            return this->decay_;
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->sum_;
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & decay_;
+            ar & sum_;
+        }
+
+    private:
+        double decay_;
+        double sum_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // timed_ew_count_impl
+    //    the sum of the weights of the samples, which decay exponentially with
+    //    the time elapsed since their timestamps
+    /**
+        @brief Exponentially weighted count of timestamped samples
+
+        The weight of a sample is \f$e^{-r (t - t_i)}\f$ at the time \f$t\f$ of the latest sample,
+        \f$t_i\f$ being its timestamp, so that samples irregularly spaced in time are weighted by
+        their age rather than by the number of samples that followed them:
+
+        \f[
+            S_n = e^{-r (t_n - t_{n-1})} S_{n-1} + 1, \quad S_0 = 0.
+        \f]
+
+        The timestamps must not decrease. Samples with the same timestamp have the same weight.
+
+        @param ew_alpha The smoothing factor \f$\alpha\f$, in \f$(0,1]\f$, per unit of time,
+               so that \f$e^{-r} = 1-\alpha\f$
+        @param ew_half_life The time \f$h\f$ after which the weight of a sample halves, if
+               \f$\alpha\f$ is not given, so that \f$r = \ln 2 / h\f$
+        @param timestamp The time of the sample
+    */
+    template<typename Sample, typename Timestamp>
+    struct timed_ew_count_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef double result_type;
+
+        template<typename Args>
+        timed_ew_count_impl(Args const &args)
+          : rate_(detail::ew_decay_rate(args))
+          , decay_(0.)
+          , sum_(0.)
+          , last_()
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            Timestamp const &now = args[timestamp];
+            if(0. != this->sum_)
+            {
+                BOOST_ASSERT(!numeric::less(now, this->last_));
+                double const elapsed = static_cast<double>(numeric::minus(now, this->last_));
+                this->decay_ = 0. == elapsed ? 1. : std::exp(-this->rate_ * elapsed);
+            }
+            this->sum_ = this->sum_ * this->decay_ + 1.;
+            this->last_ = now;
+        }
+
+        // the factor the weights of the earlier samples were multiplied
+        // by when the latest sample was added
+        double decay() const
+        {
+            return this->decay_;
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->sum_;
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & rate_;
+            ar & decay_;
+            ar & sum_;
+            ar & last_;
+        }
+
+    private:
+        double rate_;
+        double decay_;
+        double sum_;
+        Timestamp last_;    // the timestamp of the latest sample
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ew_count_decay
+    //    the factor the weights of the earlier samples were multiplied by when
+    //    the latest sample was added
+    template<typename Args>
+    double ew_count_decay(Args const &args)
+    {
+        return find_accumulator<tag::ew_count>(args[accumulator]).decay();
+    }
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::ew_count
+// tag::timed_ew_count
+//
+namespace tag
+{
+    struct ew_count
+      : depends_on<>
+      , tag::ew_alpha
+      , tag::ew_half_life
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::ew_count_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::ew_alpha::alpha named parameter
+        static boost::parameter::keyword<tag::ew_alpha> const alpha;
+        /// tag::ew_half_life::half_life named parameter
+        static boost::parameter::keyword<tag::ew_half_life> const half_life;
+        #endif
+    };
+
+    template<typename Timestamp>
+    struct timed_ew_count
+      : depends_on<>
+      , tag::ew_alpha
+      , tag::ew_half_life
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::timed_ew_count_impl< mpl::_1, Timestamp > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::ew_alpha::alpha named parameter
+        static boost::parameter::keyword<tag::ew_alpha> const alpha;
+        /// tag::ew_half_life::half_life named parameter
+        static boost::parameter::keyword<tag::ew_half_life> const half_life;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::ew_count
+//
+namespace extract
+{
+    extractor<tag::ew_count> const ew_count = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(ew_count)
+}
+
+using extract::ew_count;
+
+// for the purposes of feature-based dependency resolution,
+// timed_ew_count provides the same feature as ew_count, so the
+// exponentially weighted statistics decay with time instead
+template<typename Timestamp>
+struct feature_of<tag::timed_ew_count<Timestamp> >
+  : feature_of<tag::ew_count>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
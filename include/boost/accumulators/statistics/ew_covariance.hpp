@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+// ew_covariance.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_EW_COVARIANCE_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_EW_COVARIANCE_HPP
+
+#include <cstddef>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/ew_count.hpp>
+#include <boost/accumulators/statistics/ewma.hpp>
+#include <boost/accumulators/statistics/covariance.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ew_covariance_impl
+    //    exponentially weighted moving covariance of the samples and variates
+    /**
+        @brief Exponentially weighted moving covariance
+
+        The covariance of the samples \f$X\f$ and variates \f$X'\f$ about their exponentially
+        weighted moving averages, weighted by the weights \f$w_i\f$ of ew_count:
+
+        \f[
+            \hat{c}_n = \frac{C_n}{S_n}, \quad
+            C_n = d_n C_{n-1} + (X_n - \hat{\mu}_n)(X_n' - \hat{\mu}_{n-1}')^T,
+        \f]
+
+        \f$d_n\f$ being the decay applied by the latest update. The average of the samples is
+        that of ewma, and the average of the variates is kept beside the co-moment \f$C_n\f$.
+
+        @param ew_alpha The smoothing factor \f$\alpha\f$
+        @param ew_half_life The half-life of the weights, if \f$\alpha\f$ is not given
+    */
+    template<typename Sample, typename VariateType, typename VariateTag>
+    struct ew_covariance_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type sample_type;
+        typedef typename numeric::functional::fdiv<VariateType, std::size_t>::result_type variate_type;
+        // for boost::result_of
+        typedef typename numeric::functional::outer_product<sample_type, variate_type>::result_type result_type;
+
+        template<typename Args>
+        ew_covariance_impl(Args const &args)
+          : mean_of_variates_(
+                numeric::fdiv(args[parameter::keyword<VariateTag>::get() | VariateType()], numeric::one<std::size_t>::value)
+            )
+          , comoment_(
+                numeric::outer_product(
+                    numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value)
+                  , this->mean_of_variates_
+                )
+            )
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            double const sum_of_weights = ew_count(args);
+            VariateType const &variate = args[parameter::keyword<VariateTag>::get()];
+            if(1. == sum_of_weights)
+            {
+                // the earlier samples have no weight left, and the deviations are zero
+                this->mean_of_variates_ = numeric::fdiv(variate, numeric::one<std::size_t>::value);
+                this->comoment_ = numeric::outer_product(args[sample] - ewma(args), variate - this->mean_of_variates_);
+            }
+            else
+            {
+                this->comoment_ = this->comoment_ * impl::ew_count_decay(args)
+                                + numeric::outer_product(args[sample] - ewma(args), variate - this->mean_of_variates_);
+                this->mean_of_variates_ = this->mean_of_variates_
+                                        + numeric::fdiv(variate - this->mean_of_variates_, sum_of_weights);
+            }
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return numeric::fdiv(this->comoment_, ew_count(args));
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & mean_of_variates_;
+            ar & comoment_;
+        }
+
+    private:
+        variate_type mean_of_variates_;
+        result_type comoment_;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::ew_covariance
+//
+namespace tag
+{
+    template<typename VariateType, typename VariateTag>
+    struct ew_covariance
+      : depends_on< ew_count, ewma >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::ew_covariance_impl< mpl::_1, VariateType, VariateTag > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::ew_alpha::alpha named parameter
+        static boost::parameter::keyword<tag::ew_alpha> const alpha;
+        /// tag::ew_half_life::half_life named parameter
+        static boost::parameter::keyword<tag::ew_half_life> const half_life;
+        #endif
+    };
+
+    struct abstract_ew_covariance
+      : depends_on<>
+    {
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::ew_covariance
+//
+namespace extract
+{
+    extractor<tag::abstract_ew_covariance> const ew_covariance = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(ew_covariance)
+}
+
+using extract::ew_covariance;
+
+template<typename VariateType, typename VariateTag>
+struct feature_of<tag::ew_covariance<VariateType, VariateTag> >
+  : feature_of<tag::abstract_ew_covariance>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+// ew_variance.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_EW_VARIANCE_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_EW_VARIANCE_HPP
+
+#include <cstddef>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/ew_count.hpp>
+#include <boost/accumulators/statistics/ewma.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ew_variance_impl
+    //    exponentially weighted moving variance
+    /**
+        @brief Exponentially weighted moving variance
+
+        The variance of the samples about their exponentially weighted moving average
+        \f$\hat{\mu}_n\f$, weighted by the weights \f$w_i\f$ of ew_count:
+
+        \f[
+            \hat{\sigma}_n^2 = \frac{M_n}{S_n}, \quad M_n = \sum_{i=1}^n w_i (X_i - \hat{\mu}_n)^2.
+        \f]
+
+        When a sample is added, the weights of the others are multiplied by the decay \f$d_n\f$,
+        and the weighted form of Welford's update gives
+
+        \f[
+            M_n = d_n M_{n-1} + (X_n - \hat{\mu}_{n-1})(X_n - \hat{\mu}_n)
+                = d_n M_{n-1} + \frac{S_n}{S_n - 1}(X_n - \hat{\mu}_n)^2,
+        \f]
+
+        so only \f$M_n\f$ is kept beside the average. The variance is that of the weighted
+        population, without a correction for the number of effective samples.
+
+        @param ew_alpha The smoothing factor \f$\alpha\f$
+        @param ew_half_life The half-life of the weights, if \f$\alpha\f$ is not given
+    */
+    template<typename Sample>
+    struct ew_variance_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type result_type;
+
+        template<typename Args>
+        ew_variance_impl(Args const &args)
+          : moment_(numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value))
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            double const sum_of_weights = ew_count(args);
+            result_type const delta = args[sample] - ewma(args);
+            if(1. == sum_of_weights)
+            {
+                // the earlier samples have no weight left, and delta is zero
+                this->moment_ = delta * delta;
+            }
+            else
+            {
+                this->moment_ = this->moment_ * impl::ew_count_decay(args)
+                              + delta * delta * (sum_of_weights / (sum_of_weights - 1.));
+            }
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return numeric::fdiv(this->moment_, ew_count(args));
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & moment_;
+        }
+
+    private:
+        result_type moment_;    // the weighted sum of the squared deviations
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::ew_variance
+//
+namespace tag
+{
+    struct ew_variance
+      : depends_on< ew_count, ewma >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::ew_variance_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::ew_alpha::alpha named parameter
+        static boost::parameter::keyword<tag::ew_alpha> const alpha;
+        /// tag::ew_half_life::half_life named parameter
+        static boost::parameter::keyword<tag::ew_half_life> const half_life;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::ew_variance
+//
+namespace extract
+{
+    extractor<tag::ew_variance> const ew_variance = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(ew_variance)
+}
+
+using extract::ew_variance;
+
+}} // namespace boost::accumulators
+
+#endif
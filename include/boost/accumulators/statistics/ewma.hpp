@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// ewma.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_EWMA_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_EWMA_HPP
+
+#include <cstddef>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/ew_count.hpp>
+
+namespace boost { namespace accumulators
+{
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ewma_impl
+    //    exponentially weighted moving average
+    /**
+        @brief Exponentially weighted moving average
+
+        The mean of the samples weighted by the weights \f$w_i\f$ of ew_count, which decay
+        exponentially with the number of later samples, or with their age for timed_ew_count:
+
+        \f[
+            \hat{\mu}_n = \frac{\sum_{i=1}^n w_i X_i}{S_n} = \hat{\mu}_{n-1} + \frac{X_n - \hat{\mu}_{n-1}}{S_n}.
+        \f]
+
+        Dividing by the sum of the weights \f$S_n\f$ rather than by its limit \f$1/\alpha\f$ keeps the
+        first samples from being biased towards the first one. Only the average is kept.
+
+        @param ew_alpha The smoothing factor \f$\alpha\f$
+        @param ew_half_life The half-life of the weights, if \f$\alpha\f$ is not given
+    */
+    template<typename Sample>
+    struct ewma_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type result_type;
+
+        template<typename Args>
+        ewma_impl(Args const &args)
+          : mean_(numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value))
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            double const sum_of_weights = ew_count(args);
+            if(1. == sum_of_weights)
+            {
+                // the earlier samples have no weight left
+                this->mean_ = numeric::fdiv(args[sample], numeric::one<std::size_t>::value);
+            }
+            else
+            {
+                this->mean_ = this->mean_ + numeric::fdiv(args[sample] - this->mean_, sum_of_weights);
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->mean_;
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & mean_;
+        }
+
+    private:
+        result_type mean_;
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::ewma
+//
+namespace tag
+{
+    struct ewma
+      : depends_on< ew_count >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::ewma_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::ew_alpha::alpha named parameter
+        static boost::parameter::keyword<tag::ew_alpha> const alpha;
+        /// tag::ew_half_life::half_life named parameter
+        static boost::parameter::keyword<tag::ew_half_life> const half_life;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::ewma
+//
+namespace extract
+{
+    extractor<tag::ewma> const ewma = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(ewma)
+}
+
+using extract::ewma;
+
+}} // namespace boost::accumulators
+
+#endif
@@ -0,0 +1,485 @@
+///////////////////////////////////////////////////////////////////////////////
+// hdr_histogram.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_HDR_HISTOGRAM_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_HDR_HISTOGRAM_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/bit_scan.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/quantile_probability.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/utility.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// hdr_histogram_significant_digits named parameter
+//
+BOOST_PARAMETER_NESTED_KEYWORD(tag, hdr_histogram_significant_digits, significant_digits)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(hdr_histogram_significant_digits)
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // hdr_histogram_impl
+    //  log-bucketed histogram with a fixed relative precision
+    /**
+        @brief High dynamic range histogram
+
+        The samples are counted in buckets whose width is proportional to their value, as in Gil
+        Tene's HdrHistogram: the values from 0 to \f$2^m - 1\f$ each get a bucket of their own, and
+        every power of two above that is split into \f$2^{m-1}\f$ buckets of equal width, where
+        \f$2^m\f$ is the smallest power of two of at least \f$2 \cdot 10^d\f$ for \f$d\f$ significant
+        decimal digits. So any sample is known to within a relative error of \f$10^{-d}\f$, over the
+        whole range of 64-bit values.
+
+        The bucket of a sample is computed from the position of its highest set bit, without a
+        search, and there is nothing to cache or sort, so recording a sample costs a handful of
+        instructions. The counts grow on demand up to the bucket of the largest sample seen.
+
+        The samples must be non-negative and are truncated to integers, so pick the unit of the
+        samples (for example nanoseconds) to match the resolution that is needed; negative samples
+        and NaN are counted as 0, and samples of \f$2^{64}\f$ and above, infinity included, as
+        \f$2^{64}-1\f$. Histograms are mergeable.
+
+        The result is a range of std::pair, each holding the smallest value of a bucket and the number
+        of samples in it, for all non-empty buckets in ascending order. Use tag::hdr_quantile and
+        tag::hdr_cdf to query the histogram.
+
+        @param hdr_histogram_significant_digits The number of significant decimal digits \f$d\f$, from
+               1 to 5. Defaults to 3, which takes up to 440 KB.
+    */
+    template<typename Sample>
+    struct hdr_histogram_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef boost::uint64_t value_type;
+        typedef std::vector<std::size_t> array_type;
+        typedef std::vector<std::pair<value_type, std::size_t> > histogram_type;
+        // for boost::result_of
+        typedef iterator_range<typename histogram_type::const_iterator> result_type;
+        typedef mpl::true_ is_range_aware;
+
+        template<typename Args>
+        hdr_histogram_impl(Args const &args)
+          : significant_digits(args[hdr_histogram_significant_digits | 3])
+          , counts()
+          , histogram()
+        {
+            if(this->significant_digits < 1 || this->significant_digits > 5)
+            {
+                boost::throw_exception(std::invalid_argument("the number of significant digits must be from 1 to 5"));
+            }
+            this->init();
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->record(args[sample]);
+        }
+
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->record_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]));
+        }
+
+        template<typename Args>
+        void merge(hdr_histogram_impl const &that, Args const &)
+        {
+            if(this->significant_digits == that.significant_digits)
+            {
+                if(this->counts.size() < that.counts.size())
+                {
+                    this->counts.resize(that.counts.size());
+                }
+                for(std::size_t i = 0; i < that.counts.size(); ++i)
+                {
+                    this->counts[i] += that.counts[i];
+                }
+            }
+            else
+            {
+                // different precision: count each bucket of that at its lowest value
+                for(std::size_t i = 0; i < that.counts.size(); ++i)
+                {
+                    if(0 != that.counts[i])
+                    {
+                        std::size_t const j = this->index_of(that.lowest_value(i));
+                        this->reserve(j);
+                        this->counts[j] += that.counts[i];
+                    }
+                }
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            this->histogram.clear();
+            for(std::size_t i = 0; i < this->counts.size(); ++i)
+            {
+                if(0 != this->counts[i])
+                {
+                    this->histogram.push_back(std::make_pair(this->lowest_value(i), this->counts[i]));
+                }
+            }
+            return make_iterator_range(this->histogram);
+        }
+
+        /**
+            @return The largest value of the bucket that holds the sample of rank \f$p N\f$, rounded,
+                    or of the lowest non-empty bucket if \c p is 0. NaN if no samples have been
+                    added.
+        */
+        float_type quantile(double p) const
+        {
+            std::size_t const total = this->total();
+            if(0 == total)
+            {
+                return std::numeric_limits<float_type>::quiet_NaN();
+            }
+
+            std::size_t target = static_cast<std::size_t>(p * static_cast<double>(total) + 0.5);
+            target = (std::max)(target, std::size_t(1));
+            std::size_t so_far = 0;
+            std::size_t i = 0;
+            for(; i < this->counts.size(); ++i)
+            {
+                so_far += this->counts[i];
+                if(so_far >= target)
+                {
+                    break;
+                }
+            }
+            i = (std::min)(i, this->counts.size() - 1);
+            value_type const v = (p > 0.) ? this->highest_value(i) : this->lowest_value(i);
+            return static_cast<float_type>(v);
+        }
+
+        /**
+            @return The fraction of the samples in the buckets up to and including the one of \c x.
+                    NaN if no samples have been added.
+        */
+        float_type cdf(float_type x) const
+        {
+            std::size_t const total = this->total();
+            if(0 == total)
+            {
+                return std::numeric_limits<float_type>::quiet_NaN();
+            }
+            if(x < 0)
+            {
+                return 0;
+            }
+
+            std::size_t const last = (std::min)(this->index_of(this->to_value(x)) + 1, this->counts.size());
+            std::size_t so_far = 0;
+            for(std::size_t i = 0; i < last; ++i)
+            {
+                so_far += this->counts[i];
+            }
+            return numeric::fdiv(static_cast<float_type>(so_far), total);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & significant_digits;
+            ar & counts;
+            this->init();
+        }
+
+    private:
+        void init()
+        {
+            // 2 * 10^d, so that two values 10^-d apart never share a bucket
+            double const largest_exact = 2. * std::pow(10., static_cast<double>(this->significant_digits));
+            int const magnitude = static_cast<int>(std::ceil(std::log(largest_exact) / std::log(2.)));
+            this->half_count_magnitude = magnitude - 1;
+            this->half_count = std::size_t(1) << this->half_count_magnitude;
+            this->mask = (value_type(1) << magnitude) - 1;
+            this->leading_zero_base = 64 - this->half_count_magnitude - 1;
+        }
+
+        template<typename T>
+        static value_type to_value(T const &x)
+        {
+            return to_value(x, is_floating_point<T>());
+        }
+
+        template<typename T>
+        static value_type to_value(T const &x, mpl::false_)
+        {
+            return x > T() ? static_cast<value_type>(x) : value_type(0);
+        }
+
+        // 2^64 and above, infinity included, would overflow the conversion,
+        // so they count as the largest value
+        template<typename T>
+        static value_type to_value(T const &x, mpl::true_)
+        {
+            if(!(x > T()))
+            {
+                return value_type(0);
+            }
+            if(!(x < static_cast<T>(18446744073709551616.)))
+            {
+                return (std::numeric_limits<value_type>::max)();
+            }
+            return static_cast<value_type>(x);
+        }
+
+        template<typename T>
+        void record(T const &x)
+        {
+            std::size_t const i = this->index_of(to_value(x));
+            this->reserve(i);
+            ++this->counts[i];
+        }
+
+        template<typename Iter>
+        void record_samples(Iter first, Iter last)
+        {
+            for(; first != last; ++first)
+            {
+                this->record(*first);
+            }
+        }
+
+        void reserve(std::size_t i)
+        {
+            if(i >= this->counts.size())
+            {
+                // whole powers of two at a time
+                this->counts.resize(((i >> this->half_count_magnitude) + 1) << this->half_count_magnitude);
+            }
+        }
+
+        // values below 2^m have buckets of width 1; above, the bucket is given
+        // by the highest set bit and the m-1 bits below it
+        std::size_t index_of(value_type v) const
+        {
+            int const bucket = this->leading_zero_base - numeric::detail::count_leading_zeros(v | this->mask);
+            std::size_t const sub_bucket = static_cast<std::size_t>(v >> bucket);
+            return (std::size_t(bucket + 1) << this->half_count_magnitude) + sub_bucket - this->half_count;
+        }
+
+        // the number of trailing bits that index i does not resolve
+        int shift_of(std::size_t i) const
+        {
+            int const bucket = static_cast<int>(i >> this->half_count_magnitude) - 1;
+            return bucket < 0 ? 0 : bucket;
+        }
+
+        value_type lowest_value(std::size_t i) const
+        {
+            int const bucket = static_cast<int>(i >> this->half_count_magnitude) - 1;
+            value_type sub_bucket = (i & (this->half_count - 1)) + this->half_count;
+            if(bucket < 0)
+            {
+                return sub_bucket - this->half_count;
+            }
+            return sub_bucket << bucket;
+        }
+
+        value_type highest_value(std::size_t i) const
+        {
+            return this->lowest_value(i) + ((value_type(1) << this->shift_of(i)) - 1);
+        }
+
+        std::size_t total() const
+        {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < this->counts.size(); ++i)
+            {
+                sum += this->counts[i];
+            }
+            return sum;
+        }
+
+        int significant_digits;
+        int half_count_magnitude;
+        std::size_t half_count;
+        value_type mask;
+        int leading_zero_base;
+        array_type counts;
+        mutable histogram_type histogram;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // hdr_quantile_impl
+    //  quantile estimate from an hdr_histogram
+    /**
+        @brief Quantile estimation from the HDR histogram, for any probability
+
+        @param quantile_probability The probability of the quantile to be estimated.
+    */
+    template<typename Sample>
+    struct hdr_quantile_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        // for boost::result_of
+        typedef float_type result_type;
+        // nothing to accumulate, so a block of samples is trivially handled
+        typedef mpl::true_ is_range_aware;
+
+        hdr_quantile_impl(dont_care)
+        {
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return find_accumulator<tag::hdr_histogram>(args[accumulator]).quantile(args[quantile_probability]);
+        }
+
+        // no state of its own; the histogram does the merging
+        void merge(dont_care, dont_care)
+        {
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // hdr_cdf_impl
+    //  cumulative distribution estimate from an hdr_histogram
+    /**
+        @brief Estimate of the cumulative distribution function from the HDR histogram
+
+        Pass the value at which to evaluate the distribution function as the sample parameter, as in
+        <tt>hdr_cdf(acc, sample = x)</tt>.
+    */
+    template<typename Sample>
+    struct hdr_cdf_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        // for boost::result_of
+        typedef float_type result_type;
+        // nothing to accumulate, so a block of samples is trivially handled
+        typedef mpl::true_ is_range_aware;
+
+        hdr_cdf_impl(dont_care)
+        {
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return find_accumulator<tag::hdr_histogram>(args[accumulator]).cdf(args[sample]);
+        }
+
+        // no state of its own; the histogram does the merging
+        void merge(dont_care, dont_care)
+        {
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::hdr_histogram
+// tag::hdr_quantile
+// tag::hdr_cdf
+//
+namespace tag
+{
+    struct hdr_histogram
+      : depends_on<>
+      , hdr_histogram_significant_digits
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::hdr_histogram_impl<mpl::_1> impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::hdr_histogram::significant_digits named parameter
+        static boost::parameter::keyword<hdr_histogram_significant_digits> const significant_digits;
+        #endif
+    };
+    struct hdr_quantile
+      : depends_on<hdr_histogram>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::hdr_quantile_impl<mpl::_1> impl;
+    };
+    struct hdr_cdf
+      : depends_on<hdr_histogram>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::hdr_cdf_impl<mpl::_1> impl;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::hdr_histogram
+// extract::hdr_quantile
+// extract::hdr_cdf
+//
+namespace extract
+{
+    extractor<tag::hdr_histogram> const hdr_histogram = {};
+    extractor<tag::hdr_quantile> const hdr_quantile = {};
+    extractor<tag::hdr_cdf> const hdr_cdf = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(hdr_histogram)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(hdr_quantile)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(hdr_cdf)
+}
+
+using extract::hdr_histogram;
+using extract::hdr_quantile;
+using extract::hdr_cdf;
+
+// for the purposes of feature-based dependency resolution,
+// hdr_quantile provides the same feature as quantile
+template<>
+struct feature_of<tag::hdr_quantile>
+  : feature_of<tag::quantile>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
@@ -0,0 +1,558 @@
+///////////////////////////////////////////////////////////////////////////////
+// kll.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_KLL_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_KLL_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/throw_exception.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/quantile_probability.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/utility.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// kll_k named parameter
+//
+BOOST_PARAMETER_NESTED_KEYWORD(tag, kll_k, k)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(kll_k)
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // kll_impl
+    //  mergeable quantile sketch
+    /**
+        @brief Compactor-based quantile sketch (KLL, or ReqSketch in the relative error mode)
+
+        The samples are kept in a stack of compactors. A sample in compactor \f$h\f$ stands for
+        \f$2^h\f$ samples of the input. When the compactors hold more samples than they have room for,
+        the lowest compactor that is full is sorted, and every other one of its samples, starting at a
+        random offset, moves up one level while the rest is discarded. Every compaction changes the
+        rank of any value by at most \f$2^h\f$, and in either direction with the same probability.
+
+        With <tt>ErrorMode = additive_error</tt> this is the sketch of Karnin, Lang and Liberty. The
+        capacity of the compactors shrinks geometrically by a factor of 2/3 from the top down, with a
+        floor of 8, so the sketch holds \f$O(k \log(N / k))\f$ samples and the error of the rank of any
+        value is \f$O(N / k)\f$ with high probability.
+
+        With <tt>ErrorMode = relative_error</tt> this is the high-rank-accuracy ReqSketch of Cormode,
+        Karnin, Liberty, Thaler and Vesel&yacute;. Each compactor protects the larger half of its samples
+        and compacts its smaller samples a few sections at a time, so the error of a rank is
+        proportional to the number of samples above it: the 99.9th percentile is as accurate, relative
+        to the 0.1% of samples above it, as the median is relative to all of them. The sketch holds
+        \f$O(k \log^{1.5}(N / k))\f$ samples.
+
+        The result is a range of std::pair, each holding a retained sample and the number of input
+        samples it stands for, in ascending order of the samples. Use tag::kll_quantile to query the
+        sketch.
+
+        Extracting a result sorts the retained samples, so it modifies the accumulator; it is not safe
+        to extract from the same accumulator on several threads at once.
+
+        @param kll_k The accuracy parameter \f$k\f$: the capacity of the top compactor, or the size
+               of a section of the relative error sketch. Defaults to 200, or 12 for the relative
+               error sketch.
+    */
+    template<typename Sample, typename ErrorMode>
+    struct kll_impl
+      : accumulator_base
+    {
+        typedef std::vector<Sample> array_type;
+        typedef std::pair<Sample, std::size_t> item_type;
+        typedef std::vector<item_type> sorted_type;
+        // for boost::result_of
+        typedef iterator_range<typename sorted_type::const_iterator> result_type;
+
+        typedef is_same<ErrorMode, relative_error> is_relative;
+
+        template<typename Args>
+        kll_impl(Args const &args)
+          : k(args[kll_k | (is_relative::value ? 12 : 200)])
+          , cnt(0)
+          , retained(0)
+          , capacity(0)
+          , random_state(0x9e3779b9u)
+          , levels()
+          , is_dirty(false)
+          , sorted()
+        {
+            if(is_relative::value && (this->k < 4 || 0 != this->k % 2))
+            {
+                boost::throw_exception(std::invalid_argument("the section size k must be even and at least 4"));
+            }
+            this->grow();
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->levels[0].items.push_back(args[sample]);
+            ++this->cnt;
+            ++this->retained;
+            this->is_dirty = true;
+            if(this->retained >= this->capacity)
+            {
+                this->compress();
+            }
+        }
+
+        template<typename Args>
+        void merge(kll_impl const &that, Args const &)
+        {
+            while(this->levels.size() < that.levels.size())
+            {
+                this->grow();
+            }
+            for(std::size_t h = 0; h < that.levels.size(); ++h)
+            {
+                level &mine = this->levels[h];
+                level const &theirs = that.levels[h];
+                mine.items.insert(mine.items.end(), theirs.items.begin(), theirs.items.end());
+                mine.state |= theirs.state;
+                mine.section_size = (std::min)(mine.section_size, theirs.section_size);
+                mine.num_sections = (std::max)(mine.num_sections, theirs.num_sections);
+                this->retained += theirs.items.size();
+            }
+            this->cnt += that.cnt;
+            this->is_dirty = true;
+            this->update_capacity();
+            while(this->retained >= this->capacity)
+            {
+                this->compress();
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            this->sort();
+            return make_iterator_range(this->sorted);
+        }
+
+        /**
+            @return The smallest retained sample whose estimated rank exceeds \c p times the number of
+                    samples. Throws if the sketch is empty and \c Sample has no NaN.
+        */
+        Sample quantile(double p) const
+        {
+            this->sort();
+            if(this->sorted.empty())
+            {
+                if(std::numeric_limits<Sample>::has_quiet_NaN)
+                {
+                    return std::numeric_limits<Sample>::quiet_NaN();
+                }
+                boost::throw_exception(std::runtime_error("quantile of an empty kll sketch"));
+            }
+
+            double const target = p * static_cast<double>(this->cnt);
+            std::size_t so_far = 0;
+            for(typename sorted_type::const_iterator it = this->sorted.begin(); it != this->sorted.end(); ++it)
+            {
+                so_far += it->second;
+                if(static_cast<double>(so_far) > target)
+                {
+                    return it->first;
+                }
+            }
+            return this->sorted.back().first;
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & k;
+            ar & cnt;
+            ar & retained;
+            ar & capacity;
+            ar & random_state;
+            ar & levels;
+            this->is_dirty = true;
+        }
+
+    private:
+        struct level
+        {
+            level()
+              : items(), sorted_size(0), state(0), section_size(0), num_sections(0)
+            {
+            }
+
+            // sort the samples that arrived since the last compaction and merge
+            // them into the ones that are already sorted
+            void sort()
+            {
+                std::sort(this->items.begin() + this->sorted_size, this->items.end());
+                std::inplace_merge(this->items.begin(), this->items.begin() + this->sorted_size, this->items.end());
+                this->sorted_size = this->items.size();
+            }
+
+            template<class Archive>
+            void serialize(Archive & ar, const unsigned int file_version)
+            {
+                ar & items;
+                ar & state;
+                ar & section_size;
+                ar & num_sections;
+                this->sorted_size = 0;
+            }
+
+            array_type items;
+            // the number of samples at the front of items that are in order
+            std::size_t sorted_size;
+            // for the relative error sketch: the number of compactions so
+            // far, the size of a section, and the number of sections
+            std::size_t state;
+            std::size_t section_size;
+            std::size_t num_sections;
+        };
+
+        // the number of samples level h can hold before it must be compacted
+        std::size_t level_capacity(std::size_t h) const
+        {
+            return this->level_capacity(h, is_relative());
+        }
+
+        std::size_t level_capacity(std::size_t h, mpl::false_) const
+        {
+            double const depth = static_cast<double>(this->levels.size() - h - 1);
+            std::size_t const cap = static_cast<std::size_t>(std::ceil(this->k * std::pow(2. / 3., depth)));
+            return (std::max)(cap, std::size_t(8));
+        }
+
+        std::size_t level_capacity(std::size_t h, mpl::true_) const
+        {
+            return 2 * this->levels[h].section_size * this->levels[h].num_sections;
+        }
+
+        void grow()
+        {
+            this->levels.push_back(level());
+            this->levels.back().section_size = this->k;
+            this->levels.back().num_sections = 3;
+            this->update_capacity();
+        }
+
+        void update_capacity()
+        {
+            this->capacity = 0;
+            for(std::size_t h = 0; h < this->levels.size(); ++h)
+            {
+                this->capacity += this->level_capacity(h);
+            }
+        }
+
+        // compact the lowest level that is full, growing the stack if it is the top
+        void compress()
+        {
+            for(std::size_t h = 0; h < this->levels.size(); ++h)
+            {
+                if(this->levels[h].items.size() >= this->level_capacity(h))
+                {
+                    if(h + 1 == this->levels.size())
+                    {
+                        this->grow();
+                    }
+                    this->compact(h, is_relative());
+                    this->update_capacity();
+                    return;
+                }
+            }
+        }
+
+        // halve all samples of level h, keeping one if there is an odd number
+        void compact(std::size_t h, mpl::false_)
+        {
+            level &lvl = this->levels[h];
+            lvl.sort();
+            this->promote(h, lvl.items.size() % 2, lvl.items.size());
+        }
+
+        // halve the smallest samples of level h, as many sections of them as the
+        // number of trailing ones of the compaction count plus one
+        void compact(std::size_t h, mpl::true_)
+        {
+            level &lvl = this->levels[h];
+            lvl.sort();
+
+            std::size_t sections = 1;
+            for(std::size_t state = lvl.state; (state & 1) && sections < lvl.num_sections; state >>= 1)
+            {
+                ++sections;
+            }
+
+            // the larger half of the capacity is protected, and so are the
+            // sections of the other half that are not due; anything beyond the
+            // capacity is compacted along with the sections that are
+            std::size_t last = lvl.items.size() - (2 * lvl.num_sections - sections) * lvl.section_size;
+            last -= last % 2;
+            this->promote(h, 0, last);
+
+            // after 2^(sections - 1) compactions, double the number of sections and
+            // shrink them by sqrt(2), so the capacity of the level grows by sqrt(2)
+            if(++lvl.state >= (std::size_t(1) << (lvl.num_sections - 1)))
+            {
+                lvl.state = 0;
+                lvl.num_sections *= 2;
+                std::size_t size = static_cast<std::size_t>(lvl.section_size / std::sqrt(2.));
+                lvl.section_size = (std::max)(size - size % 2, std::size_t(4));
+            }
+        }
+
+        // move every other sample in [first, last) of the sorted level h up a level,
+        // and discard the others
+        void promote(std::size_t h, std::size_t first, std::size_t last)
+        {
+            array_type &items = this->levels[h].items;
+            array_type &up = this->levels[h + 1].items;
+            std::size_t const offset = this->coin();
+            for(std::size_t i = first + offset; i < last; i += 2)
+            {
+                up.push_back(items[i]);
+            }
+            items.erase(items.begin() + first, items.begin() + last);
+            this->levels[h].sorted_size = items.size();
+            this->retained -= (last - first) / 2;
+        }
+
+        // a fair coin, from a xorshift generator
+        std::size_t coin()
+        {
+            this->random_state ^= this->random_state << 13;
+            this->random_state ^= this->random_state >> 17;
+            this->random_state ^= this->random_state << 5;
+            this->random_state &= 0xffffffffu;
+            return (this->random_state >> 16) & 1;
+        }
+
+        struct item_less
+        {
+            bool operator ()(item_type const &left, item_type const &right) const
+            {
+                return left.first < right.first;
+            }
+        };
+
+        // merge the levels into one sorted list of samples and weights
+        void sort() const
+        {
+            if(!this->is_dirty)
+            {
+                return;
+            }
+
+            this->sorted.clear();
+            this->sorted.reserve(this->retained);
+            for(std::size_t h = 0; h < this->levels.size(); ++h)
+            {
+                array_type const &items = this->levels[h].items;
+                for(std::size_t i = 0; i < items.size(); ++i)
+                {
+                    this->sorted.push_back(item_type(items[i], std::size_t(1) << h));
+                }
+            }
+            std::sort(this->sorted.begin(), this->sorted.end(), item_less());
+            this->is_dirty = false;
+        }
+
+        std::size_t k;
+        std::size_t cnt;
+        std::size_t retained;
+        std::size_t capacity;
+        unsigned long random_state;
+        std::vector<level> levels;
+        mutable bool is_dirty;
+        mutable sorted_type sorted;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // kll_quantile_impl
+    //  quantile estimate from a kll sketch
+    /**
+        @brief Quantile estimation from the KLL or relative error sketch, for any probability
+
+        @param quantile_probability The probability of the quantile to be estimated.
+    */
+    template<typename Sample>
+    struct kll_quantile_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef Sample result_type;
+
+        kll_quantile_impl(dont_care)
+        {
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return find_accumulator<tag::kll>(args[accumulator]).quantile(args[quantile_probability]);
+        }
+
+        // no state of its own; the sketch does the merging
+        void merge(dont_care, dont_care)
+        {
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::kll
+// tag::relative_kll
+//
+namespace tag
+{
+    struct kll
+      : depends_on<>
+      , kll_k
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::kll_impl<mpl::_1, additive_error> impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::kll::k named parameter
+        static boost::parameter::keyword<kll_k> const k;
+        #endif
+    };
+    struct relative_kll
+      : depends_on<>
+      , kll_k
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::kll_impl<mpl::_1, relative_error> impl;
+    };
+}
+
+// for the purposes of feature-based dependency resolution,
+// relative_kll provides the same feature as kll
+template<>
+struct feature_of<tag::relative_kll>
+  : feature_of<tag::kll>
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::kll_quantile
+// tag::relative_kll_quantile
+//
+namespace tag
+{
+    struct kll_quantile
+      : depends_on<kll>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::kll_quantile_impl<mpl::_1> impl;
+    };
+    struct relative_kll_quantile
+      : depends_on<relative_kll>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::kll_quantile_impl<mpl::_1> impl;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::kll
+// extract::kll_quantile
+// extract::relative_kll
+// extract::relative_kll_quantile
+//
+namespace extract
+{
+    extractor<tag::kll> const kll = {};
+    extractor<tag::kll_quantile> const kll_quantile = {};
+    extractor<tag::relative_kll> const relative_kll = {};
+    extractor<tag::relative_kll_quantile> const relative_kll_quantile = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(kll)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(kll_quantile)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(relative_kll)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(relative_kll_quantile)
+}
+
+using extract::kll;
+using extract::kll_quantile;
+using extract::relative_kll;
+using extract::relative_kll_quantile;
+
+// kll(additive_error) -> kll
+template<>
+struct as_feature<tag::kll(additive_error)>
+{
+    typedef tag::kll type;
+};
+
+// kll(relative_error) -> relative_kll
+template<>
+struct as_feature<tag::kll(relative_error)>
+{
+    typedef tag::relative_kll type;
+};
+
+// kll_quantile(additive_error) -> kll_quantile
+template<>
+struct as_feature<tag::kll_quantile(additive_error)>
+{
+    typedef tag::kll_quantile type;
+};
+
+// kll_quantile(relative_error) -> relative_kll_quantile
+template<>
+struct as_feature<tag::kll_quantile(relative_error)>
+{
+    typedef tag::relative_kll_quantile type;
+};
+
+// for the purposes of feature-based dependency resolution,
+// kll_quantile and relative_kll_quantile provide the same
+// feature as quantile
+template<>
+struct feature_of<tag::kll_quantile>
+  : feature_of<tag::quantile>
+{
+};
+
+template<>
+struct feature_of<tag::relative_kll_quantile>
+  : feature_of<tag::kll_quantile>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
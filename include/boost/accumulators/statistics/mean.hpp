@@ -8,11 +8,13 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_MEAN_HPP_EAN_28_10_2005
 #define BOOST_ACCUMULATORS_STATISTICS_MEAN_HPP_EAN_28_10_2005
 
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/placeholders.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
@@ -32,9 +34,14 @@ namespace impl
     {
         // for boost::result_of
         typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type result_type;
+        // nothing to accumulate, so a block of samples is trivially handled
+        typedef mpl::true_ is_range_aware;
 
         mean_impl(dont_care) {}
 
+        // the result is computed from the merged count and sum
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -63,14 +70,33 @@ namespace impl
         template<typename Args>
         void operator ()(Args const &args)
         {
+            // updated in place, so a vector-valued mean needs no temporaries
+            std::size_t cnt = count(args);
+            this->mean *= cnt - 1;
+            this->mean += args[parameter::keyword<Tag>::get()];
+            this->mean /= cnt;
+        }
+
+        template<typename Args>
+        void merge(immediate_mean_impl const &that, Args const &args)
+        {
+            // count is merged after this, so both counts are still unmerged
             std::size_t cnt = count(args);
-            this->mean = numeric::fdiv(
-                (this->mean * (cnt - 1)) + args[parameter::keyword<Tag>::get()]
-              , cnt
-            );
+            std::size_t that_cnt = count(args[merged_accumulator]);
+            if(0 == cnt)
+            {
+                this->mean = that.mean;
+            }
+            else if(0 != that_cnt)
+            {
+                this->mean = numeric::fdiv(
+                    (this->mean * cnt) + (that.mean * that_cnt)
+                  , cnt + that_cnt
+                );
+            }
         }
 
-        result_type result(dont_care) const
+        result_type const &result(dont_care) const
         {
             return this->mean;
         }
@@ -9,11 +9,16 @@
 #define BOOST_ACCUMULATORS_STATISTICS_MIN_HPP_EAN_28_10_2005
 
 #include <limits>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 
@@ -30,6 +35,7 @@ namespace impl
     {
         // for boost::result_of
         typedef Sample result_type;
+        typedef mpl::true_ is_range_aware;
 
         template<typename Args>
         min_impl(Args const &args)
@@ -43,6 +49,17 @@ namespace impl
             numeric::min_assign(this->min_, args[sample]);
         }
 
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]));
+        }
+
+        void merge(min_impl const &that, dont_care)
+        {
+            numeric::min_assign(this->min_, that.min_);
+        }
+
         result_type result(dont_care) const
         {
             return this->min_;
@@ -56,6 +73,34 @@ namespace impl
         }
 
     private:
+        template<typename Iter>
+        void add_samples(Iter first, Iter last)
+        {
+            this->add_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::true_)
+        {
+            if(first != last)
+            {
+                Sample const *data = numeric::detail::block_data(first);
+                this->min_ = numeric::detail::block_min(data, data + (last - first), this->min_);
+            }
+        }
+
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::false_)
+        {
+            Sample m = this->min_;
+            for(; first != last; ++first)
+            {
+                numeric::min_assign(m, *first);
+            }
+            this->min_ = m;
+        }
+
         Sample min_;
     };
 
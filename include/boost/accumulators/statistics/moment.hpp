@@ -10,12 +10,17 @@
 
 #include <boost/config/no_tr1/cmath.hpp>
 #include <boost/mpl/int.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
@@ -40,6 +45,29 @@ namespace boost { namespace numeric
         T z = y * y;
         return (N % 2) ? (z * x) : z;
     }
+
+    /// INTERNAL ONLY
+    ///
+    template<typename T, typename U>
+    void pow_assign(T &y, U const &x, mpl::int_<1>)
+    {
+        y = numeric::promote<T>(x);
+    }
+
+    /// INTERNAL ONLY
+    /// pow computed into y with the same multiplications, so that the
+    /// storage of y is reused
+    template<typename T, typename U, int N>
+    void pow_assign(T &y, U const &x, mpl::int_<N>)
+    {
+        using namespace operators;
+        numeric::pow_assign(y, x, mpl::int_<N/2>());
+        y *= y;
+        if(N % 2)
+        {
+            y *= x;
+        }
+    }
 }}
 
 namespace boost { namespace accumulators
@@ -56,17 +84,33 @@ namespace impl
         BOOST_MPL_ASSERT_RELATION(N::value, >, 0);
         // for boost::result_of
         typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type result_type;
+        typedef mpl::true_ is_range_aware;
 
         template<typename Args>
         moment_impl(Args const &args)
           : sum(args[sample | Sample()])
+          , power(sum)
         {
         }
 
         template<typename Args>
         void operator ()(Args const &args)
         {
-            this->sum += numeric::pow(args[sample], N());
+            // the power goes into a member, so that vector-valued samples need
+            // no temporaries
+            numeric::pow_assign(this->power, args[sample], N());
+            this->sum += this->power;
+        }
+
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]));
+        }
+
+        void merge(moment_impl const &that, dont_care)
+        {
+            this->sum += that.sum;
         }
 
         template<typename Args>
@@ -83,7 +127,36 @@ namespace impl
         }
 
     private:
+        template<typename Iter>
+        void add_samples(Iter first, Iter last)
+        {
+            this->add_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::true_)
+        {
+            if(first != last)
+            {
+                Sample const *data = numeric::detail::block_data(first);
+                this->sum = numeric::detail::block_sum_of_powers(data, data + (last - first), this->sum, N());
+            }
+        }
+
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::false_)
+        {
+            Sample s = this->sum;
+            for(; first != last; ++first)
+            {
+                s += numeric::pow(*first, N());
+            }
+            this->sum = s;
+        }
+
         Sample sum;
+        Sample power;
     };
 
 } // namespace impl
@@ -0,0 +1,431 @@
+///////////////////////////////////////////////////////////////////////////////
+// multi_rolling.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_MULTI_ROLLING_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_MULTI_ROLLING_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <boost/throw_exception.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::rolling_window_horizons::horizons named parameter
+BOOST_PARAMETER_NESTED_KEYWORD(tag, rolling_window_horizons, horizons)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_window_horizons)
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // multi_rolling_count_impl
+    //    returns the number of samples in the rolling window of each horizon
+    /**
+        @brief Rolling count over several horizons
+
+        The horizons are window sizes, specified at construction time with the
+        rolling_window_horizons named parameter, none larger than the rolling_window_size of
+        the one rolling_window_plus1 buffer that the rolling statistics of all the horizons
+        read. The sample leaving the window of horizon \f$h\f$ is the one \f$h\f$ samples
+        before the latest in the buffer, so each sample is stored once, however many horizons
+        there are.
+
+        The constructor throws std::invalid_argument if a horizon is 0 or larger than the
+        rolling_window_size. The buffer must be that of the last N samples: the statistics
+        fail to compile if a timed_rolling_window stands in for it.
+
+        @param rolling_window_horizons A range of window sizes
+        @param rolling_window_size The size of the buffer, at least the largest horizon
+    */
+    template<typename Sample>
+    struct multi_rolling_count_impl
+      : accumulator_base
+    {
+        typedef std::vector<std::size_t> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename array_type::const_iterator> result_type;
+
+        template<typename Args>
+        multi_rolling_count_impl(Args const &args)
+          : horizons_(boost::begin(args[rolling_window_horizons]), boost::end(args[rolling_window_horizons]))
+          , counts_(horizons_.size(), 0)
+        {
+            // a horizon longer than the buffer would never see its samples leave
+            for(std::size_t i = 0; i < this->horizons_.size(); ++i)
+            {
+                if(!(0 < this->horizons_[i] && this->horizons_[i] <= static_cast<std::size_t>(args[rolling_window_size])))
+                {
+                    boost::throw_exception(std::invalid_argument("the horizons must be from 1 to the rolling window size"));
+                }
+            }
+        }
+
+        template<typename Args>
+        void operator ()(Args const &)
+        {
+            // the horizons count samples, so the statistics of all the horizons
+            // need the buffer of the last N samples, not a timed_rolling_window
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            BOOST_MPL_ASSERT_MSG(
+                (is_same<range_type, typename rolling_window_plus1_impl<Sample>::result_type>::value)
+              , MULTI_ROLLING_STATISTICS_NEED_A_ROLLING_WINDOW_OF_N_SAMPLES
+              , (range_type)
+            );
+
+            for(std::size_t i = 0; i < this->horizons_.size(); ++i)
+            {
+                if(this->counts_[i] < this->horizons_[i])
+                {
+                    ++this->counts_[i];
+                }
+            }
+        }
+
+        // the window sizes
+        array_type const &horizons() const
+        {
+            return this->horizons_;
+        }
+
+        result_type result(dont_care) const
+        {
+            return result_type(this->counts_.begin(), this->counts_.end());
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & horizons_;
+            ar & counts_;
+        }
+
+    private:
+        array_type horizons_;
+        array_type counts_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // multi_rolling_horizons
+    //    the horizons of multi_rolling_count
+    template<typename Args>
+    std::vector<std::size_t> const &multi_rolling_horizons(Args const &args)
+    {
+        return find_accumulator<tag::multi_rolling_count>(args[accumulator]).horizons();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // multi_rolling_sum_impl
+    //    returns the sum of the samples in the rolling window of each horizon
+    template<typename Sample>
+    struct multi_rolling_sum_impl
+      : accumulator_base
+    {
+        typedef std::vector<Sample> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename array_type::const_iterator> result_type;
+
+        template<typename Args>
+        multi_rolling_sum_impl(Args const &args)
+          : sums_(boost::size(args[rolling_window_horizons]), args[sample | Sample()])
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            std::vector<std::size_t> const &horizons = multi_rolling_horizons(args);
+
+            for(std::size_t i = 0; i < horizons.size(); ++i)
+            {
+                this->sums_[i] += args[sample];
+                if(static_cast<std::size_t>(window.size()) > horizons[i])
+                {
+                    this->sums_[i] -= *(window.end() - 1 - horizons[i]);
+                }
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            return result_type(this->sums_.begin(), this->sums_.end());
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & sums_;
+        }
+
+    private:
+        array_type sums_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // multi_rolling_mean_impl
+    //    returns the mean of the samples in the rolling window of each horizon
+    /**
+        @brief Rolling mean over several horizons
+
+        The means are updated as those of immediate_rolling_mean: when the window of horizon
+        \f$h\f$ is full, the mean takes \f$(X_n - X_{n-h}) / h\f$, and before, the running mean
+        of the samples so far.
+    */
+    template<typename Sample>
+    struct multi_rolling_mean_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef std::vector<float_type> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename array_type::const_iterator> result_type;
+
+        template<typename Args>
+        multi_rolling_mean_impl(Args const &args)
+          : means_(
+                boost::size(args[rolling_window_horizons])
+              , numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value)
+            )
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            std::vector<std::size_t> const &horizons = multi_rolling_horizons(args);
+            std::size_t const size = static_cast<std::size_t>(window.size());
+
+            for(std::size_t i = 0; i < horizons.size(); ++i)
+            {
+                if(size > horizons[i])
+                {
+                    this->means_[i] += numeric::fdiv(args[sample] - *(window.end() - 1 - horizons[i]), horizons[i]);
+                }
+                else
+                {
+                    this->means_[i] += numeric::fdiv(args[sample] - this->means_[i], size);
+                }
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            return result_type(this->means_.begin(), this->means_.end());
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & means_;
+        }
+
+    private:
+        array_type means_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // multi_rolling_variance_impl
+    //    returns the unbiased variance of the samples in the rolling window of
+    //    each horizon
+    /**
+        @brief Rolling variance over several horizons
+
+        The sums of the squared deviations are updated as that of immediate_rolling_variance,
+        with the means of multi_rolling_mean before and after the latest sample: the latest
+        sample adds \f$(X_n - \hat{\mu}_n)(X_n - \hat{\mu}_{n-1})\f$ and the sample leaving the
+        window of horizon \f$h\f$ removes \f$(X_{n-h} - \hat{\mu}_n)(X_{n-h} - \hat{\mu}_{n-1})\f$.
+        The variance is that sum divided by the number of samples minus one, or zero for less
+        than two samples.
+    */
+    template<typename Sample>
+    struct multi_rolling_variance_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef std::vector<float_type> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename array_type::const_iterator> result_type;
+
+        template<typename Args>
+        multi_rolling_variance_impl(Args const &args)
+          : previous_means_(
+                boost::size(args[rolling_window_horizons])
+              , numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value)
+            )
+          , sums_of_squares_(previous_means_)
+          , variances_(previous_means_)
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            std::vector<std::size_t> const &horizons = multi_rolling_horizons(args);
+            typename multi_rolling_mean_impl<Sample>::result_type means =
+                find_accumulator<tag::multi_rolling_mean>(args[accumulator]).result(args);
+
+            for(std::size_t i = 0; i < horizons.size(); ++i)
+            {
+                float_type const mean = means[i];
+                this->sums_of_squares_[i] += (args[sample] - mean) * (args[sample] - this->previous_means_[i]);
+                if(static_cast<std::size_t>(window.size()) > horizons[i])
+                {
+                    Sample const &removed_sample = *(window.end() - 1 - horizons[i]);
+                    this->sums_of_squares_[i] -= (removed_sample - mean) * (removed_sample - this->previous_means_[i]);
+                    detail::prevent_underflow(this->sums_of_squares_[i]);
+                }
+                this->previous_means_[i] = mean;
+            }
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            typename multi_rolling_count_impl<Sample>::result_type counts =
+                find_accumulator<tag::multi_rolling_count>(args[accumulator]).result(args);
+            for(std::size_t i = 0; i < this->variances_.size(); ++i)
+            {
+                this->variances_[i] = counts[i] < 2
+                  ? float_type()
+                  : numeric::fdiv(this->sums_of_squares_[i], counts[i] - 1);
+            }
+            return result_type(this->variances_.begin(), this->variances_.end());
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & previous_means_;
+            ar & sums_of_squares_;
+            if(Archive::is_loading::value)
+            {
+                this->variances_.resize(this->sums_of_squares_.size());
+            }
+        }
+
+    private:
+        array_type previous_means_;
+        array_type sums_of_squares_;
+        mutable array_type variances_;
+    };
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::multi_rolling_count
+// tag::multi_rolling_sum
+// tag::multi_rolling_mean
+// tag::multi_rolling_variance
+//
+namespace tag
+{
+    struct multi_rolling_count
+      : depends_on< rolling_window_plus1 >
+      , tag::rolling_window_horizons
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::multi_rolling_count_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_horizons::horizons named parameter
+        static boost::parameter::keyword<tag::rolling_window_horizons> const horizons;
+        #endif
+    };
+
+    struct multi_rolling_sum
+      : depends_on< rolling_window_plus1, multi_rolling_count >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::multi_rolling_sum_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_horizons::horizons named parameter
+        static boost::parameter::keyword<tag::rolling_window_horizons> const horizons;
+        #endif
+    };
+
+    struct multi_rolling_mean
+      : depends_on< rolling_window_plus1, multi_rolling_count >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::multi_rolling_mean_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_horizons::horizons named parameter
+        static boost::parameter::keyword<tag::rolling_window_horizons> const horizons;
+        #endif
+    };
+
+    struct multi_rolling_variance
+      : depends_on< rolling_window_plus1, multi_rolling_count, multi_rolling_mean >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::multi_rolling_variance_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_horizons::horizons named parameter
+        static boost::parameter::keyword<tag::rolling_window_horizons> const horizons;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::multi_rolling_count
+// extract::multi_rolling_sum
+// extract::multi_rolling_mean
+// extract::multi_rolling_variance
+//
+namespace extract
+{
+    extractor<tag::multi_rolling_count> const multi_rolling_count = {};
+    extractor<tag::multi_rolling_sum> const multi_rolling_sum = {};
+    extractor<tag::multi_rolling_mean> const multi_rolling_mean = {};
+    extractor<tag::multi_rolling_variance> const multi_rolling_variance = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(multi_rolling_count)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(multi_rolling_sum)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(multi_rolling_mean)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(multi_rolling_variance)
+}
+
+using extract::multi_rolling_count;
+using extract::multi_rolling_sum;
+using extract::multi_rolling_mean;
+using extract::multi_rolling_variance;
+
+}} // namespace boost::accumulators
+
+#endif
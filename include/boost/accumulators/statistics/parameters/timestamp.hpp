@@ -0,0 +1,24 @@
+///////////////////////////////////////////////////////////////////////////////
+// timestamp.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_PARAMETERS_TIMESTAMP_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_PARAMETERS_TIMESTAMP_HPP
+
+#include <boost/parameter/keyword.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+
+namespace boost { namespace accumulators
+{
+
+// The time at which a sample was taken
+BOOST_PARAMETER_KEYWORD(tag, timestamp)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(timestamp)
+
+}} // namespace boost::accumulators
+
+#endif
@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////////////////////
+// rolling.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ROLLING_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ROLLING_HPP
+
+#include <deque>
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/parameter/nested_keyword.hpp>
+#include <boost/parameter/are_tagged_arguments.hpp>
+#include <boost/accumulators/framework/accumulator_set.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// feature_parameters named parameter
+//
+BOOST_PARAMETER_NESTED_KEYWORD(tag, rolling_feature_parameters, feature_parameters)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_feature_parameters)
+
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // no_feature_parameters
+    //    the value of rolling_feature_parameters when none are given
+    struct no_feature_parameters
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // make_feature_set
+    //    an accumulator_set constructed with the parameters of its feature
+    template<typename AccumulatorSet>
+    AccumulatorSet make_feature_set(no_feature_parameters)
+    {
+        return AccumulatorSet();
+    }
+
+    template<typename AccumulatorSet, typename Params>
+    AccumulatorSet make_feature_set(Params const &params)
+    {
+        return AccumulatorSet(params);
+    }
+}
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // rolling_impl
+    //    returns the result of Feature over the samples in the rolling window
+    /**
+        @brief Rolling window aggregation of a mergeable feature
+
+        Computes Feature over the samples of the rolling window for any feature that can be
+        merged with accumulator_set::merge(), without removing samples from it, so that features
+        such as min, max, tail or hdr_histogram, which cannot subtract the sample leaving the
+        window, can be rolled.
+
+        The window is split in two stacks of partial results of Feature, each an accumulator_set.
+        The back stack is kept as the single result of its samples, which the latest sample is
+        added to. The front stack keeps, for each of its samples, the result of that sample and
+        of all the later ones of the front stack, so the oldest sample is removed by popping
+        the result at the top. When the front stack is empty, it is rebuilt from the samples of
+        the back stack, taken from rolling_window_plus1. Each sample is added to at most two
+        partial results in its lifetime, so the updates take amortized constant time, and the
+        result merges the top of the front stack with the back stack, so it takes one merge.
+
+        The cost of this is memory: the front stack holds a full copy of the accumulator_set of
+        Feature for each of its samples, so up to the window size of them. For a feature whose
+        state grows with its parameters, such as tail, that is the window size times the cache
+        size samples, and a flip copies that many. Prefer a dedicated rolling statistic, such as
+        rolling_min or rolling_sum, where there is one.
+
+        Feature is constructed and extracted with the named parameters given as
+        rolling_feature_parameters, and with no other parameter of the enclosing set. The
+        weights of the samples, if any, are not passed to Feature.
+
+        @param rolling_window_size The number of samples in the window, or the duration of
+               a timed_rolling_window_plus1
+        @param rolling_feature_parameters The initialization parameters of Feature, one named
+               parameter or a comma-separated list of them in parentheses
+    */
+    template<typename Sample, typename Feature>
+    struct rolling_impl
+      : accumulator_base
+    {
+        typedef accumulator_set<Sample, stats<Feature> > accumulator_set_type;
+        // for boost::result_of
+        typedef typename detail::accumulator_set_result<accumulator_set_type, Feature>::type result_type;
+
+        template<typename Args>
+        rolling_impl(Args const &args)
+          : empty_(detail::make_feature_set<accumulator_set_type>(
+                args[rolling_feature_parameters | detail::no_feature_parameters()]
+            ))
+          , front_()
+          , back_(empty_)
+          , back_size_(0)
+          , merged_(empty_)
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            std::size_t const expired = rolling_window_plus1_expired(args).size();
+
+            // the samples before the latest one, of which the first expired leave
+            for(std::size_t i = 0; i != expired; ++i)
+            {
+                if(this->front_.empty())
+                {
+                    this->flip(window.begin() + i, window.end() - 1);
+                }
+                this->front_.pop_back();
+            }
+
+            this->back_(args[sample]);
+            ++this->back_size_;
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            if(this->front_.empty())
+            {
+                return this->extract(this->back_, args);
+            }
+            if(0 == this->back_size_)
+            {
+                return this->extract(this->front_.back(), args);
+            }
+            this->merged_ = this->front_.back();
+            this->merged_.merge(this->back_);
+            return this->extract(this->merged_, args);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            std::size_t front_size = this->front_.size();
+            ar & front_size;
+            if(Archive::is_loading::value)
+            {
+                this->front_.assign(front_size, this->empty_);
+            }
+            for(typename std::deque<accumulator_set_type>::iterator it = this->front_.begin(); it != this->front_.end(); ++it)
+            {
+                it->serialize(ar, file_version);
+            }
+            this->back_.serialize(ar, file_version);
+            ar & back_size_;
+        }
+
+    private:
+        // moves the samples [begin, end) of the back stack to the front stack
+        template<typename Iter>
+        void flip(Iter begin, Iter end)
+        {
+            BOOST_ASSERT(static_cast<std::size_t>(end - begin) == this->back_size_);
+            accumulator_set_type partial(this->empty_);
+            while(end != begin)
+            {
+                partial(*--end);
+                this->front_.push_back(partial);
+            }
+            this->back_ = this->empty_;
+            this->back_size_ = 0;
+        }
+
+        // Feature of the samples of acc, with the extraction parameters in args
+        template<typename Args>
+        static result_type extract(accumulator_set_type const &acc, Args const &args)
+        {
+            return rolling_impl::extract_(acc, args[rolling_feature_parameters | detail::no_feature_parameters()]);
+        }
+
+        static result_type extract_(accumulator_set_type const &acc, detail::no_feature_parameters)
+        {
+            return find_accumulator<Feature>(acc).result(accumulator = acc);
+        }
+
+        template<typename Params>
+        static result_type extract_(accumulator_set_type const &acc, Params const &params)
+        {
+            return rolling_impl::extract_(acc, params, parameter::are_tagged_arguments<Params>());
+        }
+
+        template<typename Params>
+        static result_type extract_(accumulator_set_type const &acc, Params const &params, mpl::true_)
+        {
+            return find_accumulator<Feature>(acc).result((accumulator = acc, params));
+        }
+
+        template<typename Params>
+        static result_type extract_(accumulator_set_type const &acc, Params const &params, mpl::false_)
+        {
+            // a named parameter added to a list goes in front of it
+            return find_accumulator<Feature>(acc).result((params, accumulator = acc));
+        }
+
+        accumulator_set_type empty_;                // Feature of no samples
+        std::deque<accumulator_set_type> front_;    // Feature of the samples from each one to the back stack
+        accumulator_set_type back_;                 // Feature of the samples of the back stack
+        std::size_t back_size_;
+        mutable accumulator_set_type merged_;       // the two stacks, which the result may refer to
+    };
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::rolling
+//
+namespace tag
+{
+    template<typename Feature>
+    struct rolling
+      : depends_on< rolling_window_plus1 >
+      , rolling_feature_parameters
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::rolling_impl< mpl::_1, Feature > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window::window_size named parameter
+        static boost::parameter::keyword<tag::rolling_window_size> const window_size;
+        /// tag::rolling_feature_parameters named parameter
+        static boost::parameter::keyword<rolling_feature_parameters> const feature_parameters;
+        #endif
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::rolling
+//
+namespace extract
+{
+    BOOST_ACCUMULATORS_DEFINE_EXTRACTOR(tag, rolling, (typename))
+}
+
+using extract::rolling;
+}} // namespace boost::accumulators
+
+#endif
@@ -38,7 +38,7 @@ namespace impl
         template<typename Args>
         result_type result(Args const &args) const
         {
-            return static_cast<std::size_t>(rolling_window_plus1(args).size()) - is_rolling_window_plus1_full(args);
+            return static_cast<std::size_t>(rolling_window_plus1(args).size()) - rolling_window_plus1_expired(args).size();
         }
         
         // serialization is done by accumulators it depends on
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+// rolling_max.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ROLLING_MAX_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ROLLING_MAX_HPP
+
+#include <cstddef>
+#include <boost/circular_buffer.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+namespace boost { namespace accumulators
+{
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // rolling_max_impl
+    //    returns the maximum of the samples in the rolling window
+    /**
+        @brief Rolling maximum
+
+        The positions of the samples that may still become the maximum of the window, those
+        with no larger sample after them, are kept in a deque in which their values decrease
+        from front to back. A new sample removes the positions of the samples not larger than
+        it from the back, and the position of the sample leaving the window is removed from the
+        front, so the maximum is the sample at the front. Updates take amortized constant time
+        and the result constant time. The values are read from the buffer of rolling_window_plus1,
+        so only the positions are stored; the samples must be totally ordered (no NaN). The
+        positions that leave the window are those of the samples rolling_window_plus1_expired
+        returns, so a timed_rolling_window can stand in for the window of N samples.
+    */
+    template<typename Sample>
+    struct rolling_max_impl
+      : accumulator_base
+    {
+        // for boost::result_of
+        typedef Sample result_type;
+
+        template<typename Args>
+        rolling_max_impl(Args const &args)
+          : count_(0)
+          , positions_(args[rolling_window_size | std::size_t(1)])
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            std::size_t const position = this->count_++;
+
+            // the samples before the first one in the window have left it
+            std::size_t const first = this->count_ - (window.size() - rolling_window_plus1_expired(args).size());
+            while(!this->positions_.empty() && this->positions_.front() < first)
+            {
+                this->positions_.pop_front();
+            }
+            while(!this->positions_.empty() && !numeric::greater(this->value(args, this->positions_.back()), args[sample]))
+            {
+                this->positions_.pop_back();
+            }
+            if(this->positions_.full())
+            {
+                // only a timed window can hold more samples than it was sized for
+                this->positions_.set_capacity(2 * this->positions_.capacity());
+            }
+            this->positions_.push_back(position);
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return this->positions_.empty()
+              ? numeric::as_min(Sample())
+              : this->value(args, this->positions_.front());
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & count_;
+            ar & positions_;
+        }
+
+    private:
+        // the sample at position i, which is in the window
+        template<typename Args>
+        Sample const &value(Args const &args, std::size_t i) const
+        {
+            typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+            range_type window = rolling_window_plus1(args);
+            return window.begin()[i + window.size() - this->count_];
+        }
+
+        std::size_t count_;                         // number of samples so far
+        circular_buffer<std::size_t> positions_;    // candidates for the maximum, in order
+    };
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::rolling_max
+//
+namespace tag
+{
+    struct rolling_max
+      : depends_on< rolling_window_plus1 >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::rolling_max_impl< mpl::_1 > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window::window_size named parameter
+        static boost::parameter::keyword<tag::rolling_window_size> const window_size;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::rolling_max
+//
+namespace extract
+{
+    extractor<tag::rolling_max> const rolling_max = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_max)
+}
+
+using extract::rolling_max;
+}} // namespace boost::accumulators
+
+#endif
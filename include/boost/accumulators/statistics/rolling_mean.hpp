@@ -69,21 +69,7 @@ namespace boost { namespace accumulators
          template<typename Args>
          void operator()(Args const &args)
          {
-            if(is_rolling_window_plus1_full(args))
-            {
-               if (rolling_window_plus1(args).front() > args[sample])
-                  mean_ -= numeric::fdiv(rolling_window_plus1(args).front()-args[sample],rolling_count(args));
-               else if (rolling_window_plus1(args).front() < args[sample])
-                  mean_ += numeric::fdiv(args[sample]-rolling_window_plus1(args).front(),rolling_count(args));
-            }
-            else
-            {
-               result_type prev_mean = mean_;
-               if (prev_mean > args[sample])
-                   mean_ -= numeric::fdiv(prev_mean-args[sample],rolling_count(args));
-               else if (prev_mean < args[sample])
-                   mean_ += numeric::fdiv(args[sample]-prev_mean,rolling_count(args));
-            }
+            this->update(args[sample], rolling_window_plus1_expired(args), rolling_count(args));
          }
 
          template<typename Args>
@@ -101,6 +87,39 @@ namespace boost { namespace accumulators
 
       private:
 
+         // removes the samples that left the window but the last one, which
+         // is replaced by the added sample; count is the number of samples
+         // in the window after the update
+         template<typename Range>
+         void update(Sample const &added, Range const &expired, std::size_t count)
+         {
+            typename Range::const_iterator removed = expired.begin();
+            for(std::size_t left = expired.size(); left > 1; --left, ++removed)
+            {
+               std::size_t const remaining = count + left - 2;
+               if (*removed > mean_)
+                  mean_ -= numeric::fdiv(*removed-mean_,remaining);
+               else if (*removed < mean_)
+                  mean_ += numeric::fdiv(mean_-*removed,remaining);
+            }
+
+            if(removed != expired.end())
+            {
+               if (*removed > added)
+                  mean_ -= numeric::fdiv(*removed-added,count);
+               else if (*removed < added)
+                  mean_ += numeric::fdiv(added-*removed,count);
+            }
+            else
+            {
+               result_type prev_mean = mean_;
+               if (prev_mean > added)
+                   mean_ -= numeric::fdiv(prev_mean-added,count);
+               else if (prev_mean < added)
+                   mean_ += numeric::fdiv(added-prev_mean,count);
+            }
+         }
+
          result_type mean_;
       };
    } // namespace impl
@@ -45,10 +45,7 @@ namespace impl
         template<typename Args>
         void operator ()(Args const &args)
         {
-            if(is_rolling_window_plus1_full(args))
-            {
-                this->sum_ -= numeric::pow(rolling_window_plus1(args).front(), N());
-            }
+            this->remove(rolling_window_plus1_expired(args));
             this->sum_ += numeric::pow(args[sample], N());
         }
 
@@ -66,6 +63,16 @@ namespace impl
         }
 
     private:
+        // subtracts the powers of the samples that left the window
+        template<typename Range>
+        void remove(Range const &expired)
+        {
+            for(typename Range::const_iterator it = expired.begin(); it != expired.end(); ++it)
+            {
+                this->sum_ -= numeric::pow(*it, N());
+            }
+        }
+
         result_type sum_;
     };
 } // namespace impl
@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+// rolling_quantile.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_ROLLING_QUANTILE_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_ROLLING_QUANTILE_HPP
+
+#include <set>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <boost/assert.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/config/no_tr1/cmath.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/quantile_probability.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+namespace boost { namespace accumulators
+{
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // rolling_quantile_impl
+    //    returns the quantile of the samples in the rolling window
+    /**
+        @brief Rolling quantile
+
+        The rolling quantile of probability \f$p\f$ is the sample of rank \f$\lceil pn \rceil\f$
+        in the rolling window, \f$n\f$ being the number of samples in the window:
+
+        \f[
+            \hat{q}_{n,p} = X_{\max(1, \lceil p n \rceil):n}
+        \f]
+
+        so the rolling median of an even number of samples is the lower of the two middle samples.
+
+        The samples of the window are split into two ordered multisets: the \f$\lceil pn \rceil\f$
+        smallest ones and the others. A new sample goes into the multiset it belongs to, the samples
+        leaving the window, taken from rolling_window_plus1, are erased from the ones holding them,
+        and samples then move across to restore the sizes. Updates take logarithmic time in the
+        window size per sample entering or leaving the window, and the result, the largest of the
+        smallest samples, constant time.
+        The samples must be totally ordered (no NaN).
+
+        @param quantile_probability The probability \f$p\f$, fixed at construction (0.5 by default)
+    */
+    template<typename Sample, typename Impl>
+    struct rolling_quantile_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef std::multiset<Sample> set_type;
+        // for boost::result_of
+        typedef Sample result_type;
+
+        template<typename Args>
+        rolling_quantile_impl(Args const &args)
+          : p(is_same<Impl, for_median>::value ? float_type(0.5) : args[quantile_probability | float_type(0.5)])
+          , lower_()
+          , upper_()
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->remove(rolling_window_plus1_expired(args));
+
+            if(this->upper_.empty() || numeric::less(args[sample], *this->upper_.begin()))
+            {
+                this->lower_.insert(args[sample]);
+            }
+            else
+            {
+                this->upper_.insert(args[sample]);
+            }
+
+            this->rebalance();
+        }
+
+        result_type result(dont_care) const
+        {
+            return this->lower_.empty() ? Sample() : *this->lower_.rbegin();
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            // the multisets are stored as sorted sequences
+            std::vector<Sample> lower(this->lower_.begin(), this->lower_.end());
+            std::vector<Sample> upper(this->upper_.begin(), this->upper_.end());
+            ar & p;
+            ar & lower;
+            ar & upper;
+            if(Archive::is_loading::value)
+            {
+                this->lower_ = set_type(lower.begin(), lower.end());
+                this->upper_ = set_type(upper.begin(), upper.end());
+            }
+        }
+
+    private:
+        // removes the samples that left the window
+        template<typename Range>
+        void remove(Range const &expired)
+        {
+            for(typename Range::const_iterator it = expired.begin(); it != expired.end(); ++it)
+            {
+                this->erase(*it);
+            }
+        }
+
+        // removes one sample equal to x, which is in the window
+        void erase(Sample const &x)
+        {
+            set_type &samples = this->lower_.empty() || numeric::less(*this->lower_.rbegin(), x)
+              ? this->upper_
+              : this->lower_;
+            typename set_type::iterator it = samples.find(x);
+            BOOST_ASSERT(it != samples.end());
+            samples.erase(it);
+        }
+
+        // moves samples across until lower_ holds the ceil(p*n) smallest ones
+        void rebalance()
+        {
+            std::size_t const n = this->lower_.size() + this->upper_.size();
+            std::size_t rank = static_cast<std::size_t>(std::ceil(this->p * n));
+            rank = rank < 1 ? 1 : rank > n ? n : rank;
+
+            while(this->lower_.size() > rank)
+            {
+                typename set_type::iterator last = --this->lower_.end();
+                this->upper_.insert(this->upper_.begin(), *last);
+                this->lower_.erase(last);
+            }
+            while(this->lower_.size() < rank)
+            {
+                this->lower_.insert(this->lower_.end(), *this->upper_.begin());
+                this->upper_.erase(this->upper_.begin());
+            }
+        }
+
+        float_type p;       // the quantile probability p
+        set_type lower_;    // the ceil(p*n) smallest samples of the window
+        set_type upper_;    // the other samples of the window
+    };
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::rolling_quantile
+// tag::rolling_median
+//
+namespace tag
+{
+    struct rolling_quantile
+      : depends_on< rolling_window_plus1 >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::rolling_quantile_impl< mpl::_1, regular > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window::window_size named parameter
+        static boost::parameter::keyword<tag::rolling_window_size> const window_size;
+        #endif
+    };
+
+    struct rolling_median
+      : depends_on< rolling_window_plus1 >
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::rolling_quantile_impl< mpl::_1, for_median > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window::window_size named parameter
+        static boost::parameter::keyword<tag::rolling_window_size> const window_size;
+        #endif
+    };
+} // namespace tag
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::rolling_quantile
+// extract::rolling_median
+//
+namespace extract
+{
+    extractor<tag::rolling_quantile> const rolling_quantile = {};
+    extractor<tag::rolling_median> const rolling_median = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_quantile)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_median)
+}
+
+using extract::rolling_quantile;
+using extract::rolling_median;
+}} // namespace boost::accumulators
+
+#endif
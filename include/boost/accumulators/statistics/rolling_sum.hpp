@@ -38,10 +38,7 @@ namespace impl
         template<typename Args>
         void operator ()(Args const &args)
         {
-            if(is_rolling_window_plus1_full(args))
-            {
-                this->sum_ -= rolling_window_plus1(args).front();
-            }
+            this->remove(rolling_window_plus1_expired(args));
             this->sum_ += args[sample];
         }
 
@@ -59,6 +56,16 @@ namespace impl
         }
 
     private:
+        // subtracts the samples that left the window
+        template<typename Range>
+        void remove(Range const &expired)
+        {
+            for(typename Range::const_iterator it = expired.begin(); it != expired.end(); ++it)
+            {
+                this->sum_ -= *it;
+            }
+        }
+
         Sample sum_;
     };
 } // namespace impl
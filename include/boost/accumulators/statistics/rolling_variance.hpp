@@ -21,9 +21,7 @@
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/rolling_mean.hpp>
 #include <boost/accumulators/statistics/rolling_moment.hpp>
-
-#include <boost/type_traits/is_arithmetic.hpp>
-#include <boost/utility/enable_if.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
 
 namespace boost { namespace accumulators
 {
@@ -126,12 +124,7 @@ namespace impl
             result_type mean = immediate_rolling_mean(args);
             sum_of_squares_ += (added_sample-mean)*(added_sample-previous_mean_);
 
-            if(is_rolling_window_plus1_full(args))
-            {
-                Sample removed_sample = rolling_window_plus1(args).front();
-                sum_of_squares_ -= (removed_sample-mean)*(removed_sample-previous_mean_);
-                prevent_underflow(sum_of_squares_);
-            }
+            this->remove(rolling_window_plus1_expired(args), mean);
             previous_mean_ = mean;
         }
 
@@ -156,14 +149,19 @@ namespace impl
         result_type previous_mean_;
         result_type sum_of_squares_;
 
-        template<typename T>
-        void prevent_underflow(T &non_negative_number,typename boost::enable_if<boost::is_arithmetic<T>,T>::type* = 0)
-        {
-            if (non_negative_number < T(0)) non_negative_number = T(0);
-        }
-        template<typename T>
-        void prevent_underflow(T &non_arithmetic_quantity,typename boost::disable_if<boost::is_arithmetic<T>,T>::type* = 0)
+        // subtracts the terms of the samples that left the window
+        template<typename Range>
+        void remove(Range const &expired, result_type const &mean)
         {
+            for(typename Range::const_iterator it = expired.begin(); it != expired.end(); ++it)
+            {
+                Sample removed_sample = *it;
+                sum_of_squares_ -= (removed_sample-mean)*(removed_sample-previous_mean_);
+            }
+            if(!expired.empty())
+            {
+                detail::prevent_underflow(sum_of_squares_);
+            }
         }
     };
 } // namespace impl
@@ -13,6 +13,8 @@
 #include <boost/assert.hpp>
 #include <boost/circular_buffer.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
 #include <boost/accumulators/accumulators_fwd.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
@@ -70,6 +72,28 @@ BOOST_PARAMETER_NESTED_KEYWORD(tag, rolling_window_size, window_size)
 
 BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_window_size)
 
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // prevent_underflow
+    //    clamps to zero a sum of non-negative terms from which rounding errors in
+    //    the removal of the samples leaving the window made a negative number;
+    //    quantities that are not arithmetic are left alone
+    template<typename T>
+    void prevent_underflow(T &non_negative_number, typename boost::enable_if<boost::is_arithmetic<T>, T>::type * = 0)
+    {
+        if(non_negative_number < T(0))
+        {
+            non_negative_number = T(0);
+        }
+    }
+
+    template<typename T>
+    void prevent_underflow(T &, typename boost::disable_if<boost::is_arithmetic<T>, T>::type * = 0)
+    {
+    }
+}
+
 namespace impl
 {
     ///////////////////////////////////////////////////////////////////////////////
@@ -115,6 +139,13 @@ namespace impl
             return this->buffer_.full();
         }
 
+        // the number of samples at the front of the buffer that left the
+        // window when the latest sample was added
+        std::size_t expired() const
+        {
+            return this->buffer_.full();
+        }
+
         // The result of a shifted rolling window is the range including
         // everything except the most recently added element.
         result_type result(dont_care) const
@@ -138,6 +169,21 @@ namespace impl
         return find_accumulator<tag::rolling_window_plus1>(args[accumulator]).full();
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // rolling_window_plus1_expired
+    //    the samples at the front of rolling_window_plus1 that left the window
+    //    when the latest sample was added: at most one for a window of N samples,
+    //    and any number for a window of timestamped samples
+    template<typename Args>
+    typename detail::extractor_result<Args, tag::rolling_window_plus1>::type
+    rolling_window_plus1_expired(Args const &args)
+    {
+        typedef typename detail::extractor_result<Args, tag::rolling_window_plus1>::type range_type;
+        range_type window = find_accumulator<tag::rolling_window_plus1>(args[accumulator]).result(args);
+        std::size_t expired = find_accumulator<tag::rolling_window_plus1>(args[accumulator]).expired();
+        return range_type(window.begin(), window.begin() + expired);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // rolling_window_impl
     //    stores the latest N samples, where N is specified at construction type
@@ -155,7 +201,8 @@ namespace impl
         template<typename Args>
         result_type result(Args const &args) const
         {
-            return rolling_window_plus1(args).advance_begin(is_rolling_window_plus1_full(args));
+            result_type window = find_accumulator<tag::rolling_window_plus1>(args[accumulator]).result(args);
+            return window.advance_begin(rolling_window_plus1_expired(args).size());
         }
         
         // serialization is done by accumulators it depends on
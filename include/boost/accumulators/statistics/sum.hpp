@@ -8,11 +8,17 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_SUM_HPP_EAN_28_10_2005
 #define BOOST_ACCUMULATORS_STATISTICS_SUM_HPP_EAN_28_10_2005
 
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/placeholders.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/numeric/detail/block_kernels.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/sample_range.hpp>
 #include <boost/accumulators/framework/parameters/weight.hpp>
 #include <boost/accumulators/framework/accumulators/external_accumulator.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
@@ -32,6 +38,8 @@ namespace impl
     {
         // for boost::result_of
         typedef Sample result_type;
+        // only the sum of the samples can be fed a block of samples
+        typedef mpl::bool_<is_same<Tag, tag::sample>::value> is_range_aware;
 
         template<typename Args>
         sum_impl(Args const &args)
@@ -46,6 +54,17 @@ namespace impl
             this->sum += args[parameter::keyword<Tag>::get()];
         }
 
+        template<typename Args>
+        void add_range(Args const &args)
+        {
+            this->add_samples(boost::begin(args[sample_range]), boost::end(args[sample_range]));
+        }
+
+        void merge(sum_impl const &that, dont_care)
+        {
+            this->sum += that.sum;
+        }
+
         result_type result(dont_care) const
         {
             return this->sum;
@@ -58,6 +77,35 @@ namespace impl
         }
 
     private:
+        template<typename Iter>
+        void add_samples(Iter first, Iter last)
+        {
+            this->add_samples(first, last, typename numeric::detail::has_block_kernel<Iter, Sample>::type());
+        }
+
+        // contiguous float or double samples: use the multi-lane kernel
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::true_)
+        {
+            if(first != last)
+            {
+                Sample const *data = numeric::detail::block_data(first);
+                this->sum = numeric::detail::block_sum(data, data + (last - first), this->sum);
+            }
+        }
+
+        template<typename Iter>
+        void add_samples(Iter first, Iter last, mpl::false_)
+        {
+            // accumulate into a local so the loop doesn't alias *this
+            Sample s = this->sum;
+            for(; first != last; ++first)
+            {
+                s += *first;
+            }
+            this->sum = s;
+        }
+
         Sample sum;
     };
 
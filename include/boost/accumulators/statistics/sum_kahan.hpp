@@ -61,6 +61,18 @@ struct sum_kahan_impl
         this->sum = myTmp2;
     }
 
+    // that.sum overstates that.sum's exact total by that.compensation, so
+    // both are added, each with compensation
+    void
+#if BOOST_ACCUMULATORS_GCC_VERSION > 40305
+    __attribute__((__optimize__("no-associative-math")))
+#endif
+    merge(sum_kahan_impl const &that, dont_care)
+    {
+        this->add(that.sum);
+        this->add(-that.compensation);
+    }
+
     result_type result(dont_care) const
     {
       return this->sum;
@@ -75,6 +87,18 @@ struct sum_kahan_impl
     }
 
 private:
+    void
+#if BOOST_ACCUMULATORS_GCC_VERSION > 40305
+    __attribute__((__optimize__("no-associative-math")))
+#endif
+    add(Sample const &value)
+    {
+        const Sample myTmp1 = value - this->compensation;
+        const Sample myTmp2 = this->sum + myTmp1;
+        this->compensation = (myTmp2 - this->sum) - myTmp1;
+        this->sum = myTmp2;
+    }
+
     Sample sum;
     Sample compensation;
 };
@@ -9,6 +9,8 @@
 #define BOOST_ACCUMULATORS_STATISTICS_TAIL_HPP_EAN_28_10_2005
 
 #include <vector>
+#include <numeric>
+#include <algorithm>
 #include <functional>
 #include <boost/assert.hpp>
 #include <boost/range.hpp>
@@ -129,6 +131,46 @@ namespace detail
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // tail_slot
+    /// INTERNAL ONLY
+    ///
+    struct tail_slot
+    {
+        std::size_t index;
+        bool merged;    // true if the slot is one of the tail merged into this one
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // merge_tail_slots
+    //   The slots of the at most cache_size best samples of two sorted tails, best
+    //   first, taken from this tail first on ties. The index ranges list the slots
+    //   of the tails worst first, as tail_impl::result() leaves them.
+    /// INTERNAL ONLY
+    ///
+    template<typename Predicate, typename Sample, typename IndexIterator>
+    std::vector<tail_slot> merge_tail_slots(
+        std::vector<Sample> const &samples
+      , IndexIterator begin
+      , IndexIterator end
+      , std::vector<Sample> const &that_samples
+      , IndexIterator that_begin
+      , IndexIterator that_end
+      , std::size_t cache_size
+    )
+    {
+        std::vector<tail_slot> slots;
+        slots.reserve((std::min)(cache_size, static_cast<std::size_t>((end - begin) + (that_end - that_begin))));
+        while(slots.size() < cache_size && (begin != end || that_begin != that_end))
+        {
+            tail_slot slot;
+            slot.merged = begin == end || (that_begin != that_end && Predicate()(that_samples[*(that_end - 1)], samples[*(end - 1)]));
+            slot.index = slot.merged ? *--that_end : *--end;
+            slots.push_back(slot);
+        }
+        return slots;
+    }
+
 } // namespace detail
 
 namespace impl
@@ -163,6 +205,11 @@ namespace impl
           : is_sorted(false)
           , indices()
           , samples(args[tag::tail<LeftRight>::cache_size], args[sample | Sample()])
+          , selection()
+          , order_n(0)
+          , order_value(args[sample | Sample()])
+          , sum_n(0)
+          , sum_value(args[sample | Sample()])
         {
             this->indices.reserve(this->samples.size());
         }
@@ -171,10 +218,29 @@ namespace impl
           : is_sorted(that.is_sorted)
           , indices(that.indices)
           , samples(that.samples)
+          , selection(that.selection)
+          , order_n(that.order_n)
+          , order_value(that.order_value)
+          , sum_n(that.sum_n)
+          , sum_value(that.sum_value)
         {
             this->indices.reserve(this->samples.size());
         }
 
+        tail_impl &operator =(tail_impl const &that)
+        {
+            this->is_sorted = that.is_sorted;
+            this->indices = that.indices;
+            this->samples = that.samples;
+            this->selection = that.selection;
+            this->order_n = that.order_n;
+            this->order_value = that.order_value;
+            this->sum_n = that.sum_n;
+            this->sum_value = that.sum_value;
+            this->indices.reserve(this->samples.size());
+            return *this;
+        }
+
         // This just stores the heap and the samples.
         // In operator()() below, if we are adding a new sample
         // to the sample cache, we force all the
@@ -221,6 +287,103 @@ namespace impl
             );
         }
 
+        // The number of samples in the tail
+        std::size_t size() const
+        {
+            return this->indices.size();
+        }
+
+        // The n-th best sample of the tail, for 0 < n <= size(). Unless the
+        // tail is already sorted, this selects the sample in linear time on a
+        // copy of the heap, and keeps it until the next sample is stored.
+        Sample order_statistic(std::size_t n) const
+        {
+            BOOST_ASSERT(0 < n && n <= this->indices.size());
+            if(this->is_sorted)
+            {
+                return this->samples[this->indices[this->indices.size() - n]];
+            }
+            if(n != this->order_n)
+            {
+                this->select(n);
+            }
+            return this->order_value;
+        }
+
+        // The sum of the n best samples of the tail, for n <= size(), by the
+        // same selection as order_statistic(n)
+        Sample order_statistics_sum(std::size_t n) const
+        {
+            BOOST_ASSERT(n <= this->indices.size());
+            if(0 == n)
+            {
+                return Sample(0);
+            }
+            if(n != this->sum_n)
+            {
+                if(this->is_sorted)
+                {
+                    this->sum_value = std::accumulate(
+                        boost::make_permutation_iterator(this->samples.begin(), this->indices.end() - n)
+                      , boost::make_permutation_iterator(this->samples.begin(), this->indices.end())
+                      , Sample(0)
+                    );
+                }
+                else
+                {
+                    if(n != this->order_n)
+                    {
+                        this->select(n);
+                    }
+                    this->sum_value = std::accumulate(
+                        boost::make_permutation_iterator(this->samples.begin(), this->selection.begin())
+                      , boost::make_permutation_iterator(this->samples.begin(), this->selection.begin() + n)
+                      , Sample(0)
+                    );
+                }
+                this->sum_n = n;
+            }
+            return this->sum_value;
+        }
+
+        // The slots of the best samples of this tail and that one, which the
+        // tail variates use to merge along with the tail. This sorts both tails.
+        std::vector<detail::tail_slot> merge_slots(tail_impl const &that) const
+        {
+            this->result(0);
+            that.result(0);
+            return detail::merge_tail_slots<predicate_type>(
+                this->samples
+              , this->indices.begin()
+              , this->indices.end()
+              , that.samples
+              , that.indices.begin()
+              , that.indices.end()
+              , this->samples.size()
+            );
+        }
+
+        // The merged tail is a k-way merge of the two sorted tails. Its samples
+        // fill the first slots, best first, and the indices list them worst
+        // first, which is both sorted and a heap.
+        void merge(tail_impl const &that, dont_care)
+        {
+            std::vector<detail::tail_slot> const slots(this->merge_slots(that));
+            std::vector<Sample> samples(this->samples);
+            for(std::size_t i = 0; i < slots.size(); ++i)
+            {
+                samples[i] = slots[i].merged ? that.samples[slots[i].index] : this->samples[slots[i].index];
+            }
+            this->samples.swap(samples);
+            this->indices.resize(slots.size());
+            for(std::size_t i = 0; i < slots.size(); ++i)
+            {
+                this->indices[i] = slots.size() - 1 - i;
+            }
+            this->is_sorted = true;
+            this->order_n = this->sum_n = 0;
+        }
+
     private:
 
         struct is_tail_variate
@@ -241,10 +404,26 @@ namespace impl
             this->samples[index] = args[sample];
             std::push_heap(this->indices.begin(), this->indices.end(), indirect_cmp(this->samples));
             this->is_sorted = false;
+            this->order_n = this->sum_n = 0;
             // Tell the tail variates to store their values also
             args[accumulator].template visit_if<is_tail_variate>(detail::stat_assign(args, index));
         }
 
+        // moves the n best samples to the front of the selection, the n-th best last
+        void select(std::size_t n) const
+        {
+            // The heap must be kept, so the selection works on a copy of it.
+            this->selection.assign(this->indices.begin(), this->indices.end());
+            std::nth_element(
+                this->selection.begin()
+              , this->selection.begin() + (n - 1)
+              , this->selection.end()
+              , indirect_cmp(this->samples)
+            );
+            this->order_n = n;
+            this->order_value = this->samples[this->selection[n - 1]];
+        }
+
         ///////////////////////////////////////////////////////////////////////////////
         //
         struct indirect_cmp
@@ -276,12 +455,311 @@ namespace impl
             ar & is_sorted;
             ar & indices;
             ar & samples;
+            // the selection is not saved
+            this->order_n = this->sum_n = 0;
         }
 
     private:
         mutable bool is_sorted;
         mutable std::vector<std::size_t> indices;
         std::vector<Sample> samples;
+        mutable std::vector<std::size_t> selection;  // the indices, the order_n best first
+        mutable std::size_t order_n;                 // 0, or the n of the last order_statistic
+        mutable Sample order_value;
+        mutable std::size_t sum_n;                   // 0, or the n of the last order_statistics_sum
+        mutable Sample sum_value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // buffered_tail_impl
+    /**
+        @brief The tail, kept by selection in a buffer of twice the cache size
+
+        tail_impl keeps its samples in a heap, so that each sample beating the smallest one
+        of the tail costs a pop_heap and a push_heap, and with trending data that is almost
+        every sample. buffered_tail_impl instead appends each sample beating the threshold
+        to a buffer of twice the cache size, and when the buffer is full, one nth_element
+        moves the cache size best samples to the front of the buffer and makes the worst of
+        them the threshold. Each nth_element takes linear time in the cache size and frees
+        half the buffer, so an insertion takes amortized constant time. The samples stay in
+        the slots they were assigned, so the tail variates, told of each sample stored in a
+        slot as for tail_impl, stay consistent with it.
+
+        @param tail<LeftRight>::cache_size The number of samples of the tail
+    */
+    template<typename Sample, typename LeftRight>
+    struct buffered_tail_impl
+      : accumulator_base
+    {
+        // LeftRight must be either right or left
+        BOOST_MPL_ASSERT((
+            mpl::or_<is_same<LeftRight, right>, is_same<LeftRight, left> >
+        ));
+
+        typedef
+            typename mpl::if_<
+                is_same<LeftRight, right>
+              , numeric::functional::greater<Sample const, Sample const>
+              , numeric::functional::less<Sample const, Sample const>
+            >::type
+        predicate_type;
+
+        // for boost::result_of
+        typedef typename detail::tail_range<
+            typename std::vector<Sample>::const_iterator
+          , std::vector<std::size_t>::iterator
+        >::type result_type;
+
+        template<typename Args>
+        buffered_tail_impl(Args const &args)
+          : cache_size(args[tag::tail<LeftRight>::cache_size])
+          , used(0)
+          , threshold(0)
+          , is_full(false)
+          , is_sorted(false)
+          , indices(2 * cache_size)
+          , samples(2 * cache_size, args[sample | Sample()])
+          , order_n(0)
+          , order_value(args[sample | Sample()])
+          , sum_n(0)
+          , sum_value(args[sample | Sample()])
+        {
+            BOOST_ASSERT(0 < this->cache_size);
+            for(std::size_t i = 0; i < this->indices.size(); ++i)
+            {
+                this->indices[i] = i;
+            }
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            if(!this->is_full || predicate_type()(args[sample], this->samples[this->threshold]))
+            {
+                // the first free slot follows the slots in use
+                std::size_t index = this->indices[this->used++];
+                this->samples[index] = args[sample];
+                this->is_sorted = false;
+                this->order_n = this->sum_n = 0;
+                // Tell the tail variates to store their values also
+                args[accumulator].template visit_if<is_tail_variate>(detail::stat_assign(args, index));
+
+                if(this->used == this->indices.size())
+                {
+                    this->select();
+                }
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            if(!this->is_sorted)
+            {
+                if(this->used > this->cache_size)
+                {
+                    this->select();
+                }
+                std::sort(this->indices.begin(), this->indices.begin() + this->used, indirect_cmp(this->samples));
+                // The tail range is reversed, so the best sample must come last.
+                std::reverse(this->indices.begin(), this->indices.begin() + this->used);
+                this->is_sorted = true;
+            }
+
+            return detail::make_tail_range(
+                this->samples.begin()
+              , this->indices.begin()
+              , this->indices.begin() + this->used
+            );
+        }
+
+        // The number of samples in the tail
+        std::size_t size() const
+        {
+            return (std::min)(this->used, this->cache_size);
+        }
+
+        // The n-th best sample of the tail, for 0 < n <= size(). Unless the
+        // tail is already sorted, this selects the sample in linear time, and
+        // keeps it until the next sample is stored.
+        Sample order_statistic(std::size_t n) const
+        {
+            BOOST_ASSERT(0 < n && n <= this->size());
+            if(this->is_sorted)
+            {
+                return this->samples[this->indices[this->used - n]];
+            }
+            if(n != this->order_n)
+            {
+                this->select(n);
+            }
+            return this->order_value;
+        }
+
+        // The sum of the n best samples of the tail, for n <= size(), by the
+        // same selection as order_statistic(n)
+        Sample order_statistics_sum(std::size_t n) const
+        {
+            BOOST_ASSERT(n <= this->size());
+            if(0 == n)
+            {
+                return Sample(0);
+            }
+            if(n != this->sum_n)
+            {
+                typename std::vector<std::size_t>::const_iterator begin = this->indices.begin();
+                if(this->is_sorted)
+                {
+                    begin += this->used - n;
+                }
+                else if(n != this->order_n)
+                {
+                    this->select(n);
+                }
+                this->sum_value = std::accumulate(
+                    boost::make_permutation_iterator(this->samples.begin(), begin)
+                  , boost::make_permutation_iterator(this->samples.begin(), begin + n)
+                  , Sample(0)
+                );
+                this->sum_n = n;
+            }
+            return this->sum_value;
+        }
+
+        // The slots of the best samples of this tail and that one, which the
+        // tail variates use to merge along with the tail. This sorts both tails.
+        std::vector<detail::tail_slot> merge_slots(buffered_tail_impl const &that) const
+        {
+            this->result(0);
+            that.result(0);
+            return detail::merge_tail_slots<predicate_type>(
+                this->samples
+              , this->indices.begin()
+              , this->indices.begin() + this->used
+              , that.samples
+              , that.indices.begin()
+              , that.indices.begin() + that.used
+              , this->cache_size
+            );
+        }
+
+        // As for tail_impl, the merged samples fill the first slots, best first,
+        // and the other slots are free. The worst of a full tail is the threshold.
+        void merge(buffered_tail_impl const &that, dont_care)
+        {
+            std::vector<detail::tail_slot> const slots(this->merge_slots(that));
+            std::vector<Sample> samples(this->samples);
+            for(std::size_t i = 0; i < slots.size(); ++i)
+            {
+                samples[i] = slots[i].merged ? that.samples[slots[i].index] : this->samples[slots[i].index];
+            }
+            this->samples.swap(samples);
+            this->used = slots.size();
+            for(std::size_t i = 0; i < this->indices.size(); ++i)
+            {
+                this->indices[i] = i < this->used ? this->used - 1 - i : i;
+            }
+            this->is_full = this->used == this->cache_size;
+            this->threshold = this->is_full ? this->used - 1 : 0;
+            this->is_sorted = true;
+            this->order_n = this->sum_n = 0;
+        }
+
+    private:
+
+        struct is_tail_variate
+        {
+            template<typename T>
+            struct apply
+              : detail::is_tail_variate_feature<
+                    typename detail::feature_tag<T>::type
+                  , LeftRight
+                >
+            {};
+        };
+
+        // keeps the cache_size best samples in the slots in use, and frees the others
+        void select() const
+        {
+            std::nth_element(
+                this->indices.begin()
+              , this->indices.begin() + (this->cache_size - 1)
+              , this->indices.begin() + this->used
+              , indirect_cmp(this->samples)
+            );
+            this->threshold = this->indices[this->cache_size - 1];
+            this->used = this->cache_size;
+            this->is_full = true;
+        }
+
+        // moves the n best samples to the front of the slots in use, the n-th best last
+        void select(std::size_t n) const
+        {
+            if(this->used > this->cache_size)
+            {
+                this->select();
+            }
+            // The slots in use are in no particular order, so the selection works in place.
+            std::nth_element(
+                this->indices.begin()
+              , this->indices.begin() + (n - 1)
+              , this->indices.begin() + this->used
+              , indirect_cmp(this->samples)
+            );
+            this->order_n = n;
+            this->order_value = this->samples[this->indices[n - 1]];
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        //
+        struct indirect_cmp
+        {
+            typedef std::size_t first_argument_type;
+            typedef std::size_t second_argument_type;
+            typedef bool result_type;
+
+            indirect_cmp(std::vector<Sample> const &s)
+              : samples(s)
+            {
+            }
+
+            bool operator ()(std::size_t left, std::size_t right) const
+            {
+                return predicate_type()(this->samples[left], this->samples[right]);
+            }
+
+        private:
+            BOOST_DELETED_FUNCTION(indirect_cmp &operator =(indirect_cmp const &))
+            std::vector<Sample> const &samples;
+        };
+
+    public:
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            ar & cache_size;
+            ar & used;
+            ar & threshold;
+            ar & is_full;
+            ar & is_sorted;
+            ar & indices;
+            ar & samples;
+            // the selection is not saved
+            this->order_n = this->sum_n = 0;
+        }
+
+    private:
+        std::size_t cache_size;
+        mutable std::size_t used;               // the number of slots in use, at the front of indices
+        mutable std::size_t threshold;          // the slot of the worst sample kept by the last selection
+        mutable bool is_full;                   // true once a selection has set the threshold
+        mutable bool is_sorted;
+        mutable std::vector<std::size_t> indices;   // the slots in use, then the free slots
+        std::vector<Sample> samples;
+        mutable std::size_t order_n;            // 0, or the n of the last order_statistic
+        mutable Sample order_value;
+        mutable std::size_t sum_n;              // 0, or the n of the last order_statistics_sum
+        mutable Sample sum_value;
     };
 
 } // namespace impl
@@ -323,6 +801,21 @@ namespace tag
         #endif
     };
 
+    template<typename LeftRight>
+    struct buffered_tail
+      : depends_on<>
+      , tail_cache_size_named_arg<LeftRight>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::buffered_tail_impl<mpl::_1, LeftRight> impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::tail<LeftRight>::cache_size named parameter
+        static boost::parameter::keyword<tail_cache_size_named_arg<LeftRight> > const cache_size;
+        #endif
+    };
+
     struct abstract_tail
       : depends_on<>
     {
@@ -347,6 +840,14 @@ struct feature_of<tag::tail<LeftRight> >
 {
 };
 
+// for the purposes of feature-based dependency resolution,
+// buffered_tail provides the same feature as tail
+template<typename LeftRight>
+struct feature_of<tag::buffered_tail<LeftRight> >
+  : feature_of<tag::tail<LeftRight> >
+{
+};
+
 }} // namespace boost::accumulators
 
 #endif
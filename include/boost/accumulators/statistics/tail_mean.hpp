@@ -68,6 +68,9 @@ namespace impl
 
         coherent_tail_mean_impl(dont_care) {}
 
+        // the result is computed from the merged count and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -127,6 +130,9 @@ namespace impl
 
         non_coherent_tail_mean_impl(dont_care) {}
 
+        // the result is computed from the merged count and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -138,14 +144,13 @@ namespace impl
                 )
             );
 
+            // The n best samples are selected from the tail without sorting it.
+            std::size_t size = find_accumulator<tag::tail<LeftRight> >(args[accumulator]).size();
+
             // If n is in a valid range, return result, otherwise return NaN or throw exception
-            if (n <= static_cast<std::size_t>(tail(args).size()))
+            if (n <= size)
                 return numeric::fdiv(
-                    std::accumulate(
-                        tail(args).begin()
-                      , tail(args).begin() + n
-                      , Sample(0)
-                    )
+                    find_accumulator<tag::tail<LeftRight> >(args[accumulator]).order_statistics_sum(n)
                   , n
                 );
             else
@@ -157,7 +162,7 @@ namespace impl
                 else
                 {
                     std::ostringstream msg;
-                    msg << "index n = " << n << " is not in valid range [0, " << tail(args).size() << ")";
+                    msg << "index n = " << n << " is not in valid range [0, " << size << ")";
                     boost::throw_exception(std::runtime_error(msg.str()));
                     return Sample(0);
                 }
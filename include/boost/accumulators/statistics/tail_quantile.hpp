@@ -65,6 +65,9 @@ namespace impl
 
         tail_quantile_impl(dont_care) {}
 
+        // the result is computed from the merged count and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -76,12 +79,15 @@ namespace impl
                 )
             );
 
+            // The n-th best sample is selected from the tail without sorting it.
+            std::size_t size = find_accumulator<tag::tail<LeftRight> >(args[accumulator]).size();
+
             // If n is in a valid range, return result, otherwise return NaN or throw exception
-            if ( n < static_cast<std::size_t>(tail(args).size()))
+            if ( n < size )
             {
-               // Note that the cached samples of the left are sorted in ascending order,
-               // whereas the samples of the right tail are sorted in descending order
-               return *(boost::begin(tail(args)) + n - 1);
+               // Note that the n-th best sample of the left tail is the n-th smallest,
+               // whereas that of the right tail is the n-th largest
+               return find_accumulator<tag::tail<LeftRight> >(args[accumulator]).order_statistic(n);
             }
             else
             {
@@ -92,7 +98,7 @@ namespace impl
                 else
                 {
                     std::ostringstream msg;
-                    msg << "index n = " << n << " is not in valid range [0, " << tail(args).size() << ")";
+                    msg << "index n = " << n << " is not in valid range [0, " << size << ")";
                     boost::throw_exception(std::runtime_error(msg.str()));
                     return Sample(0);
                 }
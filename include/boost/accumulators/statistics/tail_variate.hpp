@@ -8,14 +8,22 @@
 #ifndef BOOST_STAT_STATISTICS_TAIL_VARIATE_HPP_EAN_28_10_2005
 #define BOOST_STAT_STATISTICS_TAIL_VARIATE_HPP_EAN_28_10_2005
 
+#include <vector>
+#include <stdexcept>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
 #include <boost/range.hpp>
 #include <boost/mpl/always.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_copy_constructible.hpp>
 #include <boost/mpl/placeholders.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
 #include <boost/iterator/permutation_iterator.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/tail.hpp>
 #include <boost/serialization/vector.hpp>
@@ -41,14 +49,62 @@ namespace impl
 
         template<typename Args>
         tail_variate_impl(Args const &args)
-          : variates(args[tag::tail<LeftRight>::cache_size], args[parameter::keyword<VariateTag>::get() | VariateType()])
+          : variates()
         {
+            this->variates.reserve(args[tag::tail<LeftRight>::cache_size]);
         }
 
+        tail_variate_impl(tail_variate_impl const &that)
+          : variates()
+        {
+            this->variates.reserve(that.variates.capacity());
+            this->copy_variates(that.variates, typename is_copy_constructible<VariateType>::type());
+        }
+
+        tail_variate_impl &operator =(tail_variate_impl const &that)
+        {
+            if(this != &that)
+            {
+                this->copy_variates(that.variates, typename is_copy_constructible<VariateType>::type());
+            }
+            return *this;
+        }
+
+        // The tail fills its slots in order before it reuses any, so a slot is
+        // either in use or the next one. The variates are not default constructed,
+        // and when they are passed as rvalues, they are moved into their slots,
+        // so that move-only variates can be kept and large ones are not copied.
         template<typename Args>
         void assign(Args const &args, std::size_t index)
         {
-            this->variates[index] = args[parameter::keyword<VariateTag>::get()];
+            BOOST_ASSERT(index <= this->variates.size());
+            if(this->variates.size() == index)
+            {
+                this->variates.push_back(args[parameter::keyword<VariateTag>::get()]);
+            }
+            else
+            {
+                this->variates[index] = args[parameter::keyword<VariateTag>::get()];
+            }
+        }
+
+        // The tails are merged after this, so they are still unmerged, and give
+        // the slots of the merged tail.
+        template<typename Args>
+        void merge(tail_variate_impl const &that, Args const &args)
+        {
+            std::vector<detail::tail_slot> const slots(
+                find_accumulator<tag::tail<LeftRight> >(args[accumulator]).merge_slots(
+                    find_accumulator<tag::tail<LeftRight> >(args[merged_accumulator])
+                )
+            );
+            std::vector<VariateType> variates;
+            variates.reserve(this->variates.capacity());
+            for(std::size_t i = 0; i < slots.size(); ++i)
+            {
+                variates.push_back(slots[i].merged ? that.variates[slots[i].index] : this->variates[slots[i].index]);
+            }
+            this->variates.swap(variates);
         }
 
         template<typename Args>
@@ -70,6 +126,22 @@ namespace impl
             );
         }
 
+        void copy_variates(std::vector<VariateType> const &that, true_type)
+        {
+            this->variates.assign(that.begin(), that.end());
+        }
+
+        // The accumulator set copies its accumulators as it builds them, before
+        // any variate is stored. After that, move-only variates cannot be copied.
+        void copy_variates(std::vector<VariateType> const &that, false_type)
+        {
+            if(!that.empty())
+            {
+                boost::throw_exception(std::logic_error("tail variates that cannot be copied are held"));
+            }
+            this->variates.clear();
+        }
+
         // make this accumulator serializeable
         template<class Archive>
         void serialize(Archive & ar, const unsigned int file_version)
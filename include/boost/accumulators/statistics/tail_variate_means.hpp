@@ -87,6 +87,9 @@ namespace impl
 
         tail_variate_means_impl(dont_care) {}
 
+        // the result is computed from the merged count and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
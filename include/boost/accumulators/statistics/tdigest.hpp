@@ -0,0 +1,589 @@
+///////////////////////////////////////////////////////////////////////////////
+// tdigest.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_TDIGEST_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_TDIGEST_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <boost/range/iterator_range.hpp>
+#include <boost/parameter/keyword.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/type_traits/is_void.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/weight.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/quantile_probability.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/utility.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// tdigest_compression named parameter
+//
+BOOST_PARAMETER_NESTED_KEYWORD(tag, tdigest_compression, compression)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(tdigest_compression)
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // tdigest_impl
+    //  mergeable sketch of the sample distribution
+    /**
+        @brief t-digest of the sample distribution, for weighted and unweighted samples
+
+        The t-digest (Dunning and Ertl) summarizes the distribution with a sorted list of centroids, each
+        holding the mean and the total weight of the samples it stands for. Centroids near the median may
+        absorb many samples, those near the tails only a few, so that extreme quantiles stay accurate. The
+        number of centroids grows with the compression parameter \f$\delta\f$ and only logarithmically
+        with the number of samples: a centroid covering the probabilities \f$[q_l, q_r]\f$ must satisfy
+        \f$k(q_r) - k(q_l) \le 1\f$ with the scale function
+
+        \f[
+            k(q) = \frac{2\delta}{Z} \log\frac{q}{1 - q}, \qquad Z = 4 \log\frac{W}{\delta} + 24,
+        \f]
+
+        where \f$W\f$ is the total weight. The outermost centroids hold a single sample each.
+
+        The weights need not be integers. The digest keeps the smallest weight \f$u\f$ of a sample, so
+        that a centroid lighter than \f$2u\f$ is known to hold a single sample, and the extremes take up
+        the weight \f$u\f$ of a sample at each end of the distribution.
+
+        New samples are collected in a buffer, which is sorted and folded into the centroids once it holds
+        \f$5 \delta\f$ samples, or when a result is extracted. Unlike the \f$P^2\f$ estimators the digest can
+        answer a query for any probability or value after the fact, and two digests can be merged.
+
+        The result is a range of std::pair, each holding the mean and the weight of one centroid, in
+        ascending order of the means. Use tag::tdigest_quantile and tag::tdigest_cdf to query the digest.
+
+        Extracting a result folds the buffer into the centroids, so it modifies the accumulator; it is not
+        safe to extract from the same accumulator on several threads at once.
+
+        @param tdigest_compression The compression \f$\delta\f$. Defaults to 100, which keeps the
+               absolute error of the 99.9th percentile of \f$10^5\f$ uniform samples below
+               \f$10^{-4}\f$.
+    */
+    template<typename Sample, typename Weight>
+    struct tdigest_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        typedef std::pair<float_type, float_type> centroid_type;
+        typedef std::vector<centroid_type> array_type;
+        // for boost::result_of
+        typedef iterator_range<typename array_type::const_iterator> result_type;
+
+        template<typename Args>
+        tdigest_impl(Args const &args)
+          : compression(args[tdigest_compression | 100.])
+          , buffer_size(static_cast<std::size_t>(5. * this->compression))
+          , total_weight()
+          , unit_(numeric::as_max(float_type()))
+          , min_(numeric::as_max(float_type()))
+          , max_(numeric::as_min(float_type()))
+          , centroids()
+          , buffer()
+        {
+            this->buffer.reserve(this->buffer_size);
+        }
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            this->add(args[sample], this->weight_of(args, is_void<Weight>()));
+        }
+
+        template<typename Args>
+        void merge(tdigest_impl const &that, Args const &)
+        {
+            this->buffer.insert(this->buffer.end(), that.centroids.begin(), that.centroids.end());
+            this->buffer.insert(this->buffer.end(), that.buffer.begin(), that.buffer.end());
+            this->total_weight += that.total_weight;
+            numeric::min_assign(this->unit_, that.unit_);
+            numeric::min_assign(this->min_, that.min_);
+            numeric::max_assign(this->max_, that.max_);
+            this->compress();
+        }
+
+        result_type result(dont_care) const
+        {
+            this->compress();
+            return make_iterator_range(this->centroids);
+        }
+
+        /**
+            @return The estimated quantile for probability \c p, or NaN if no samples have been added.
+        */
+        float_type quantile(float_type p) const
+        {
+            this->compress();
+
+            array_type const &c = this->centroids;
+            std::size_t const n = c.size();
+            if(0 == n)
+            {
+                return std::numeric_limits<float_type>::quiet_NaN();
+            }
+
+            float_type const w = this->total_weight;
+            float_type const u = this->unit_;
+            float_type const index = p * w;
+
+            if(1 == n)
+            {
+                // only the extremes are known exactly; interpolate between them
+                return this->min_ + p * (this->max_ - this->min_);
+            }
+
+            // one sample sits at each extreme, the rest of the outermost centroids
+            // is assumed to spread evenly towards their means
+            if(index < u)
+            {
+                return this->min_;
+            }
+            if(!this->is_single(c[0]) && index < c[0].second / 2)
+            {
+                return this->min_ + (index - u) / (c[0].second / 2 - u) * (c[0].first - this->min_);
+            }
+            if(index > w - u)
+            {
+                return this->max_;
+            }
+            if(!this->is_single(c[n - 1]) && w - index <= c[n - 1].second / 2)
+            {
+                return this->max_ - (w - index - u) / (c[n - 1].second / 2 - u) * (this->max_ - c[n - 1].first);
+            }
+
+            // in between, interpolate linearly between the neighbouring centroid
+            // means; a centroid of a single sample gets no spread
+            float_type so_far = c[0].second / 2;
+            for(std::size_t i = 0; i < n - 1; ++i)
+            {
+                float_type const dw = (c[i].second + c[i + 1].second) / 2;
+                if(so_far + dw > index)
+                {
+                    float_type left_unit = 0, right_unit = 0;
+                    if(this->is_single(c[i]))
+                    {
+                        if(index - so_far < c[i].second / 2)
+                        {
+                            return c[i].first;
+                        }
+                        left_unit = c[i].second / 2;
+                    }
+                    if(this->is_single(c[i + 1]))
+                    {
+                        if(so_far + dw - index <= c[i + 1].second / 2)
+                        {
+                            return c[i + 1].first;
+                        }
+                        right_unit = c[i + 1].second / 2;
+                    }
+                    float_type const z1 = index - so_far - left_unit;
+                    float_type const z2 = so_far + dw - index - right_unit;
+                    return (c[i].first * z2 + c[i + 1].first * z1) / (z1 + z2);
+                }
+                so_far += dw;
+            }
+
+            float_type const z1 = index - w + c[n - 1].second / 2;
+            float_type const z2 = c[n - 1].second / 2 - z1;
+            return (c[n - 1].first * z2 + this->max_ * z1) / (z1 + z2);
+        }
+
+        /**
+            @return The estimated fraction of the total weight at or below \c x, or NaN if no samples have
+                    been added.
+        */
+        float_type cdf(float_type x) const
+        {
+            this->compress();
+
+            array_type const &c = this->centroids;
+            std::size_t const n = c.size();
+            if(0 == n)
+            {
+                return std::numeric_limits<float_type>::quiet_NaN();
+            }
+
+            float_type const w = this->total_weight;
+            float_type const u = this->unit_;
+            if(x < this->min_)
+            {
+                return 0;
+            }
+            if(x > this->max_)
+            {
+                return 1;
+            }
+            if(1 == n)
+            {
+                return this->max_ == this->min_ ? 0.5 : (x - this->min_) / (this->max_ - this->min_);
+            }
+
+            // the tails, between an extreme and the mean of the outermost centroid
+            if(x < c[0].first)
+            {
+                if(x == this->min_)
+                {
+                    return u / (2 * w);
+                }
+                return (u + (x - this->min_) / (c[0].first - this->min_) * (c[0].second / 2 - u)) / w;
+            }
+            if(x > c[n - 1].first)
+            {
+                if(x == this->max_)
+                {
+                    return 1 - u / (2 * w);
+                }
+                return 1 - (u + (this->max_ - x) / (this->max_ - c[n - 1].first) * (c[n - 1].second / 2 - u)) / w;
+            }
+
+            float_type so_far = 0;
+            for(std::size_t i = 0; i < n - 1; ++i)
+            {
+                if(c[i].first == x)
+                {
+                    float_type dw = 0;
+                    for(; i < n && c[i].first == x; ++i)
+                    {
+                        dw += c[i].second;
+                    }
+                    return (so_far + dw / 2) / w;
+                }
+                if(x < c[i + 1].first)
+                {
+                    float_type left_excluded = 0, right_excluded = 0;
+                    if(this->is_single(c[i]))
+                    {
+                        if(this->is_single(c[i + 1]))
+                        {
+                            // two single samples and nothing in between
+                            return (so_far + c[i].second) / w;
+                        }
+                        left_excluded = c[i].second / 2;
+                    }
+                    else if(this->is_single(c[i + 1]))
+                    {
+                        right_excluded = c[i + 1].second / 2;
+                    }
+                    float_type const dw = (c[i].second + c[i + 1].second) / 2 - left_excluded - right_excluded;
+                    float_type const base = so_far + c[i].second / 2 + left_excluded;
+                    return (base + dw * (x - c[i].first) / (c[i + 1].first - c[i].first)) / w;
+                }
+                so_far += c[i].second;
+            }
+
+            // x is the mean of the last centroid
+            return 1 - c[n - 1].second / (2 * w);
+        }
+
+        // make this accumulator serializeable
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version)
+        {
+            this->compress();
+            ar & compression;
+            ar & buffer_size;
+            ar & total_weight;
+            ar & unit_;
+            ar & min_;
+            ar & max_;
+            ar & centroids;
+        }
+
+    private:
+        template<typename Args>
+        static float_type weight_of(Args const &, mpl::true_)
+        {
+            return 1;
+        }
+
+        template<typename Args>
+        static float_type weight_of(Args const &args, mpl::false_)
+        {
+            return static_cast<float_type>(args[weight]);
+        }
+
+        // no two samples weigh less than twice the lightest one
+        bool is_single(centroid_type const &c) const
+        {
+            return c.second < 2 * this->unit_;
+        }
+
+        void add(float_type x, float_type w)
+        {
+            this->buffer.push_back(centroid_type(x, w));
+            this->total_weight += w;
+            numeric::min_assign(this->unit_, w);
+            numeric::min_assign(this->min_, x);
+            numeric::max_assign(this->max_, x);
+            if(this->buffer.size() >= this->buffer_size)
+            {
+                this->compress();
+            }
+        }
+
+        struct mean_less
+        {
+            bool operator ()(centroid_type const &left, centroid_type const &right) const
+            {
+                return left.first < right.first;
+            }
+        };
+
+        // fold the buffered samples into the centroids: sort everything by mean,
+        // then sweep from left to right and merge neighbours as long as the
+        // result still covers at most one unit of the scale function
+        void compress() const
+        {
+            if(this->buffer.empty())
+            {
+                return;
+            }
+
+            array_type &in = this->buffer;
+            in.insert(in.end(), this->centroids.begin(), this->centroids.end());
+            std::sort(in.begin(), in.end(), mean_less());
+
+            array_type &out = this->centroids;
+            out.clear();
+
+            float_type const w = this->total_weight;
+            float_type const z = 4 * std::log((std::max)(w / this->compression, float_type(1))) + 24;
+            float_type const f = std::exp(-z / (2 * this->compression));
+            float_type so_far = 0;
+            float_type limit = q_limit(0, f);
+            centroid_type cur = in[0];
+            for(std::size_t i = 1; i < in.size(); ++i)
+            {
+                if((so_far + cur.second + in[i].second) / w <= limit)
+                {
+                    cur.second += in[i].second;
+                    cur.first += (in[i].first - cur.first) * in[i].second / cur.second;
+                }
+                else
+                {
+                    so_far += cur.second;
+                    out.push_back(cur);
+                    limit = q_limit(so_far / w, f);
+                    cur = in[i];
+                }
+            }
+            out.push_back(cur);
+            in.clear();
+        }
+
+        // the largest q such that k(q) - k(q0) <= 1, where f = exp(-Z / 2 delta)
+        static float_type q_limit(float_type q0, float_type f)
+        {
+            return q0 / (q0 + (1 - q0) * f);
+        }
+
+        float_type compression;
+        std::size_t buffer_size;
+        float_type total_weight;
+        float_type unit_;       // the smallest weight of a sample
+        float_type min_;
+        float_type max_;
+        mutable array_type centroids;
+        mutable array_type buffer;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // tdigest_quantile_impl
+    //  quantile estimate from a t-digest
+    /**
+        @brief Quantile estimation from the t-digest, for any probability
+
+        @param quantile_probability The probability of the quantile to be estimated.
+    */
+    template<typename Sample>
+    struct tdigest_quantile_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        // for boost::result_of
+        typedef float_type result_type;
+
+        tdigest_quantile_impl(dont_care)
+        {
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return find_accumulator<tag::tdigest>(args[accumulator]).quantile(args[quantile_probability]);
+        }
+
+        // no state of its own; the digest does the merging
+        void merge(dont_care, dont_care)
+        {
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // tdigest_cdf_impl
+    //  cumulative distribution estimate from a t-digest
+    /**
+        @brief Estimate of the cumulative distribution function from the t-digest, for any value
+
+        Pass the value at which to evaluate the distribution function as the sample parameter, as in
+        <tt>tdigest_cdf(acc, sample = x)</tt>.
+    */
+    template<typename Sample>
+    struct tdigest_cdf_impl
+      : accumulator_base
+    {
+        typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type float_type;
+        // for boost::result_of
+        typedef float_type result_type;
+
+        tdigest_cdf_impl(dont_care)
+        {
+        }
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            return find_accumulator<tag::tdigest>(args[accumulator]).cdf(args[sample]);
+        }
+
+        // no state of its own; the digest does the merging
+        void merge(dont_care, dont_care)
+        {
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::tdigest
+// tag::tdigest_quantile
+// tag::tdigest_cdf
+//
+namespace tag
+{
+    struct tdigest
+      : depends_on<>
+      , tdigest_compression
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_impl<mpl::_1, void> impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::tdigest::compression named parameter
+        static boost::parameter::keyword<tdigest_compression> const compression;
+        #endif
+    };
+    struct tdigest_quantile
+      : depends_on<tdigest>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_quantile_impl<mpl::_1> impl;
+    };
+    struct tdigest_cdf
+      : depends_on<tdigest>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_cdf_impl<mpl::_1> impl;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::tdigest
+// extract::tdigest_quantile
+// extract::tdigest_cdf
+//
+namespace extract
+{
+    extractor<tag::tdigest> const tdigest = {};
+    extractor<tag::tdigest_quantile> const tdigest_quantile = {};
+    extractor<tag::tdigest_cdf> const tdigest_cdf = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(tdigest)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(tdigest_quantile)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(tdigest_cdf)
+}
+
+using extract::tdigest;
+using extract::tdigest_quantile;
+using extract::tdigest_cdf;
+
+// for the purposes of feature-based dependency resolution,
+// tdigest_quantile provides the same feature as quantile
+template<>
+struct feature_of<tag::tdigest_quantile>
+  : feature_of<tag::quantile>
+{
+};
+
+// So that tdigest can be automatically substituted with
+// weighted_tdigest when the weight parameter is non-void
+template<>
+struct as_weighted_feature<tag::tdigest>
+{
+    typedef tag::weighted_tdigest type;
+};
+
+template<>
+struct feature_of<tag::weighted_tdigest>
+  : feature_of<tag::tdigest>
+{
+};
+
+template<>
+struct as_weighted_feature<tag::tdigest_quantile>
+{
+    typedef tag::weighted_tdigest_quantile type;
+};
+
+template<>
+struct feature_of<tag::weighted_tdigest_quantile>
+  : feature_of<tag::tdigest_quantile>
+{
+};
+
+template<>
+struct as_weighted_feature<tag::tdigest_cdf>
+{
+    typedef tag::weighted_tdigest_cdf type;
+};
+
+template<>
+struct feature_of<tag::weighted_tdigest_cdf>
+  : feature_of<tag::tdigest_cdf>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
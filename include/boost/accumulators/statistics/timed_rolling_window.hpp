@@ -0,0 +1,214 @@
+///////////////////////////////////////////////////////////////////////////////
+// timed_rolling_window.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_TIMED_ROLLING_WINDOW_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_TIMED_ROLLING_WINDOW_HPP
+
+#include <deque>
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/serialization/deque.hpp>
+#include <boost/accumulators/accumulators_fwd.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/numeric/functional.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/parameters/timestamp.hpp>
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::rolling_window_duration::window_duration named parameter
+BOOST_PARAMETER_NESTED_KEYWORD(tag, rolling_window_duration, window_duration)
+
+BOOST_ACCUMULATORS_IGNORE_GLOBAL(rolling_window_duration)
+
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // timed_rolling_window_plus1_impl
+    //    stores the samples whose timestamps are less than the duration specified
+    //    at construction time with the rolling_window_duration named parameter
+    //    before the latest timestamp, preceded by the samples that left the window
+    //    when the latest sample was added
+    /**
+        @brief Rolling window of the samples of the last period of time
+
+        The samples and their timestamps are kept in two deques, which grow and shrink with
+        the rate of the samples. The samples that leave the window when a sample is added
+        stay at the front until the next one is added, so that the rolling statistics can
+        remove them, and are then erased. The timestamps must not decrease. The latest
+        sample is always in the window.
+
+        @param rolling_window_duration The length of the window, in the units of the
+               difference of two timestamps
+        @param timestamp The time of the sample
+    */
+    template<typename Sample, typename Timestamp>
+    struct timed_rolling_window_plus1_impl
+      : accumulator_base
+    {
+        typedef typename std::deque<Sample>::const_iterator const_iterator;
+        typedef iterator_range<const_iterator> result_type;
+        typedef typename numeric::functional::minus<Timestamp const, Timestamp const>::result_type duration_type;
+
+        template<typename Args>
+        timed_rolling_window_plus1_impl(Args const &args)
+          : duration_(args[rolling_window_duration])
+          , expired_(0)
+          , samples_()
+          , timestamps_()
+        {}
+
+        template<typename Args>
+        void operator ()(Args const &args)
+        {
+            // erase the samples that left the window with the previous sample
+            this->samples_.erase(this->samples_.begin(), this->samples_.begin() + this->expired_);
+            this->timestamps_.erase(this->timestamps_.begin(), this->timestamps_.begin() + this->expired_);
+            this->expired_ = 0;
+
+            Timestamp const &now = args[timestamp];
+            BOOST_ASSERT(this->timestamps_.empty() || !numeric::less(now, this->timestamps_.back()));
+            this->samples_.push_back(args[sample]);
+            this->timestamps_.push_back(now);
+
+            std::size_t const size = this->timestamps_.size();
+            while(this->expired_ + 1 < size
+               && !numeric::less(numeric::minus(now, this->timestamps_[this->expired_]), this->duration_))
+            {
+                ++this->expired_;
+            }
+        }
+
+        // true if samples left the window when the latest sample was added
+        bool full() const
+        {
+            return 0 != this->expired_;
+        }
+
+        // the number of samples at the front of the buffer that left the
+        // window when the latest sample was added
+        std::size_t expired() const
+        {
+            return this->expired_;
+        }
+
+        result_type result(dont_care) const
+        {
+            return result_type(this->samples_.begin(), this->samples_.end());
+        }
+
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & duration_;
+            ar & expired_;
+            ar & samples_;
+            ar & timestamps_;
+        }
+
+    private:
+        duration_type duration_;
+        std::size_t expired_;               // number of samples at the front that left the window
+        std::deque<Sample> samples_;
+        std::deque<Timestamp> timestamps_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // timed_rolling_window_impl
+    //    stores the samples of the last period of time, specified at construction
+    //    time with the rolling_window_duration named parameter
+    template<typename Sample, typename Timestamp>
+    struct timed_rolling_window_impl
+      : accumulator_base
+    {
+        typedef typename std::deque<Sample>::const_iterator const_iterator;
+        typedef iterator_range<const_iterator> result_type;
+
+        timed_rolling_window_impl(dont_care)
+        {}
+
+        template<typename Args>
+        result_type result(Args const &args) const
+        {
+            result_type window = find_accumulator<tag::rolling_window_plus1>(args[accumulator]).result(args);
+            return window.advance_begin(rolling_window_plus1_expired(args).size());
+        }
+
+        // serialization is done by accumulators it depends on
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int file_version) {}
+    };
+
+} // namespace impl
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::timed_rolling_window_plus1
+// tag::timed_rolling_window
+//
+namespace tag
+{
+    template<typename Timestamp>
+    struct timed_rolling_window_plus1
+      : depends_on<>
+      , tag::rolling_window_duration
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::timed_rolling_window_plus1_impl< mpl::_1, Timestamp > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_duration::window_duration named parameter
+        static boost::parameter::keyword<tag::rolling_window_duration> const window_duration;
+        #endif
+    };
+
+    template<typename Timestamp>
+    struct timed_rolling_window
+      : depends_on< timed_rolling_window_plus1<Timestamp> >
+      , tag::rolling_window_duration
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::timed_rolling_window_impl< mpl::_1, Timestamp > impl;
+
+        #ifdef BOOST_ACCUMULATORS_DOXYGEN_INVOKED
+        /// tag::rolling_window_duration::window_duration named parameter
+        static boost::parameter::keyword<tag::rolling_window_duration> const window_duration;
+        #endif
+    };
+
+} // namespace tag
+
+// for the purposes of feature-based dependency resolution,
+// timed_rolling_window_plus1 provides the same feature as rolling_window_plus1,
+// so the rolling statistics use it in place of the window of N samples
+template<typename Timestamp>
+struct feature_of<tag::timed_rolling_window_plus1<Timestamp> >
+  : feature_of<tag::rolling_window_plus1>
+{
+};
+
+// for the purposes of feature-based dependency resolution,
+// timed_rolling_window provides the same feature as rolling_window
+template<typename Timestamp>
+struct feature_of<tag::timed_rolling_window<Timestamp> >
+  : feature_of<tag::rolling_window>
+{
+};
+
+}} // namespace boost::accumulators
+
+#endif
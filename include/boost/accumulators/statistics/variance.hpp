@@ -8,11 +8,14 @@
 #ifndef BOOST_ACCUMULATORS_STATISTICS_VARIANCE_HPP_EAN_28_10_2005
 #define BOOST_ACCUMULATORS_STATISTICS_VARIANCE_HPP_EAN_28_10_2005
 
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/placeholders.hpp>
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
@@ -43,9 +46,14 @@ namespace impl
     {
         // for boost::result_of
         typedef typename numeric::functional::fdiv<Sample, std::size_t>::result_type result_type;
+        // nothing to accumulate, so a block of samples is trivially handled
+        typedef mpl::true_ is_range_aware;
 
         lazy_variance_impl(dont_care) {}
 
+        // the result is computed from the merged moment<2> and mean
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -94,6 +102,7 @@ namespace impl
         template<typename Args>
         variance_impl(Args const &args)
           : variance(numeric::fdiv(args[sample | Sample()], numeric::one<std::size_t>::value))
+          , deviation(variance)
         {
         }
 
@@ -103,12 +112,42 @@ namespace impl
             std::size_t cnt = count(args);
 
             if(cnt > 1)
+            {
+                // updated in place, with the deviation from the mean kept in a
+                // member, so that vector-valued samples need no temporaries
+                this->deviation = find_accumulator<MeanFeature>(args[accumulator]).result(args);
+                this->deviation -= args[parameter::keyword<Tag>::get()];
+                this->deviation *= this->deviation;
+                this->deviation /= cnt - 1;
+                this->variance *= cnt - 1;
+                this->variance /= cnt;
+                this->variance += this->deviation;
+            }
+        }
+
+        /// Merges the variance of another sample set using the pairwise update of
+        /// Chan, Golub and LeVeque:
+        /// \f[
+        ///     \sigma_n^2 = \frac{n_a \sigma_a^2 + n_b \sigma_b^2}{n} + \frac{n_a n_b}{n^2} (\mu_b - \mu_a)^2.
+        /// \f]
+        template<typename Args>
+        void merge(variance_impl const &that, Args const &args)
+        {
+            // count and mean are merged after this, so they are still unmerged
+            std::size_t cnt = count(args);
+            std::size_t that_cnt = count(args[merged_accumulator]);
+            if(0 == cnt)
+            {
+                this->variance = that.variance;
+            }
+            else if(0 != that_cnt)
             {
                 extractor<MeanFeature> mean;
-                result_type tmp = args[parameter::keyword<Tag>::get()] - mean(args);
+                result_type tmp = mean(args[merged_accumulator]) - mean(args);
+                std::size_t n = cnt + that_cnt;
                 this->variance =
-                    numeric::fdiv(this->variance * (cnt - 1), cnt)
-                  + numeric::fdiv(tmp * tmp, cnt - 1);
+                    numeric::fdiv(this->variance * cnt + that.variance * that_cnt, n)
+                  + numeric::fdiv(numeric::fdiv(tmp * tmp * cnt, n) * that_cnt, n);
             }
         }
 
@@ -126,6 +165,7 @@ namespace impl
 
     private:
         result_type variance;
+        result_type deviation;
     };
 
 } // namespace impl
@@ -26,6 +26,7 @@
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
 #include <boost/accumulators/statistics/covariance.hpp> // for numeric::outer_product() and type traits
@@ -92,6 +93,30 @@ namespace impl
             }
         }
 
+        // see covariance_impl::merge; the sums of weights take the place of the counts
+        template<typename Args>
+        void merge(weighted_covariance_impl const &that, Args const &args)
+        {
+            // count, sum_of_weights and the means are merged after this
+            if(0 == count(args))
+            {
+                this->cov_ = that.cov_;
+            }
+            else if(0 != count(args[merged_accumulator]))
+            {
+                extractor<tag::weighted_mean_of_variates<VariateType, VariateTag> > const some_weighted_mean_of_variates = {};
+
+                Weight w_sum = sum_of_weights(args);
+                Weight that_w_sum = sum_of_weights(args[merged_accumulator]);
+                Weight w = w_sum + that_w_sum;
+                this->cov_ = this->cov_ * w_sum / w + that.cov_ * that_w_sum / w
+                           + numeric::outer_product(
+                                 some_weighted_mean_of_variates(args[merged_accumulator]) - some_weighted_mean_of_variates(args)
+                               , weighted_mean(args[merged_accumulator]) - weighted_mean(args)
+                             ) * w_sum / w * that_w_sum / w;
+            }
+        }
+
         result_type result(dont_care) const
         {
             return this->cov_;
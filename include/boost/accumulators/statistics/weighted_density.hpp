@@ -45,6 +45,9 @@ namespace impl
         returned, where each pair contains the position of the bin (lower bound) and the sum of the weights (normalized with the
         sum of all weights).
 
+        As the bins are of the same size, the bin of a sample is computed from its distance to the first bin in constant
+        time, and then checked against the bin positions, so that a sample on a bin boundary goes where a search would put it.
+
         @param density_cache_size Number of first samples used to determine min and max.
         @param density_num_bins Number of bins (two additional bins collect under- and overflow samples).
     */
@@ -65,6 +68,7 @@ namespace impl
             , num_bins(args[density_num_bins])
             , samples_in_bin(num_bins + 2, 0.)
             , bin_positions(num_bins + 2)
+            , inverse_bin_size()
             , histogram(
                 num_bins + 2
               , std::make_pair(
@@ -103,52 +107,17 @@ namespace impl
                 {
                     this->bin_positions[i] = minimum + (i - 1.) * bin_size;
                 }
+                this->inverse_bin_size = numeric::fdiv(this->num_bins, maximum - minimum);
 
                 for (typename histogram_type::const_iterator iter = this->cache.begin(); iter != this->cache.end(); ++iter)
                 {
-                    if (iter->first < this->bin_positions[1])
-                    {
-                        this->samples_in_bin[0] += iter->second;
-                    }
-                    else if (iter->first >= this->bin_positions[this->num_bins + 1])
-                    {
-                        this->samples_in_bin[this->num_bins + 1] += iter->second;
-                    }
-                    else
-                    {
-                        typename array_type::iterator it = std::upper_bound(
-                            this->bin_positions.begin()
-                          , this->bin_positions.end()
-                          , iter->first
-                        );
-
-                        std::size_t d = std::distance(this->bin_positions.begin(), it);
-                        this->samples_in_bin[d - 1] += iter->second;
-                    }
+                    this->samples_in_bin[this->bin_of(iter->first)] += iter->second;
                 }
             }
             // Add each subsequent sample to the correct bin
             else if (cnt > this->cache_size)
             {
-                if (args[sample] < this->bin_positions[1])
-                {
-                    this->samples_in_bin[0] += args[weight];
-                }
-                else if (args[sample] >= this->bin_positions[this->num_bins + 1])
-                {
-                    this->samples_in_bin[this->num_bins + 1] += args[weight];
-                }
-                else
-                {
-                    typename array_type::iterator it = std::upper_bound(
-                        this->bin_positions.begin()
-                      , this->bin_positions.end()
-                      , args[sample]
-                    );
-
-                    std::size_t d = std::distance(this->bin_positions.begin(), it);
-                    this->samples_in_bin[d - 1] += args[weight];
-                }
+                this->samples_in_bin[this->bin_of(args[sample])] += args[weight];
             }
         }
 
@@ -185,14 +154,23 @@ namespace impl
             ar & bin_positions;
             ar & histogram;
             ar & is_dirty; 
+            this->inverse_bin_size = numeric::fdiv(this->num_bins, this->bin_positions[this->num_bins + 1] - this->bin_positions[1]);
         }
 
     private:
+        template<typename T>
+        std::size_t bin_of(T const &x) const
+        {
+            std::size_t i = detail::uniform_bin_index(x, this->bin_positions[1], this->inverse_bin_size, this->num_bins);
+            return detail::adjust_bin_index(this->bin_positions, x, i);
+        }
+
         std::size_t            cache_size;      // number of cached samples
         histogram_type         cache;           // cache to store the first cache_size samples with their weights as std::pair
         std::size_t            num_bins;        // number of bins
         array_type             samples_in_bin;  // number of samples in each bin
         array_type             bin_positions;   // lower bounds of bins
+        float_type             inverse_bin_size; // num_bins over the width of the inner bins
         mutable histogram_type histogram;       // histogram
         mutable bool is_dirty;
     };
@@ -16,6 +16,7 @@
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/weights.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/sum.hpp>
@@ -40,6 +41,9 @@ namespace impl
 
         weighted_mean_impl(dont_care) {}
 
+        // the result is computed from the merged weighted sum and sum of weights
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -77,6 +81,7 @@ namespace impl
                   , numeric::one<Weight>::value
                 )
             )
+          , product(args[parameter::keyword<Tag>::get() | Sample()] * numeric::one<Weight>::value)
         {
         }
 
@@ -88,11 +93,31 @@ namespace impl
             //  accumulator set passed as a named parameter
             Weight w_sum = sum_of_weights(args);
             Weight w = args[weight];
-            weighted_sample const &s = args[parameter::keyword<Tag>::get()] * w;
-            this->mean = numeric::fdiv(this->mean * (w_sum - w) + s, w_sum);
+            // updated in place, with the weighted sample in a member, so that
+            // vector-valued samples need no temporaries
+            this->product = numeric::promote<weighted_sample>(args[parameter::keyword<Tag>::get()]);
+            this->product *= w;
+            this->mean *= w_sum - w;
+            this->mean += this->product;
+            this->mean /= w_sum;
+        }
+
+        template<typename Args>
+        void merge(immediate_weighted_mean_impl const &that, Args const &args)
+        {
+            // sum_of_weights is merged after this, so both sums are still unmerged
+            Weight w_sum = sum_of_weights(args);
+            Weight that_w_sum = sum_of_weights(args[merged_accumulator]);
+            if(numeric::zero<Weight>::value != that_w_sum)
+            {
+                this->mean = numeric::fdiv(
+                    this->mean * w_sum + that.mean * that_w_sum
+                  , w_sum + that_w_sum
+                );
+            }
         }
 
-        result_type result(dont_care) const
+        result_type const &result(dont_care) const
         {
             return this->mean;
         }
@@ -106,6 +131,7 @@ namespace impl
 
     private:
         result_type mean;
+        weighted_sample product;
     };
 
 } // namespace impl
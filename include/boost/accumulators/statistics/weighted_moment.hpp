@@ -45,13 +45,23 @@ namespace impl
         template<typename Args>
         weighted_moment_impl(Args const &args)
           : sum(args[sample | Sample()] * numeric::one<Weight>::value)
+          , power(sum)
         {
         }
 
         template<typename Args>
         void operator ()(Args const &args)
         {
-            this->sum += args[weight] * numeric::pow(args[sample], N());
+            // the weighted power goes into a member, so that vector-valued
+            // samples need no temporaries
+            numeric::pow_assign(this->power, args[sample], N());
+            this->power *= args[weight];
+            this->sum += this->power;
+        }
+
+        void merge(weighted_moment_impl const &that, dont_care)
+        {
+            this->sum += that.sum;
         }
 
         template<typename Args>
@@ -69,6 +79,7 @@ namespace impl
 
     private:
         weighted_sample sum;
+        weighted_sample power;
     };
 
 } // namespace impl
@@ -40,6 +40,7 @@ namespace impl
                 args[parameter::keyword<Tag>::get() | Sample()]
                   * numeric::one<Weight>::value
             )
+          , product_(weighted_sum_)
         {
         }
 
@@ -47,7 +48,16 @@ namespace impl
         void operator ()(Args const &args)
         {
             // what about overflow?
-            this->weighted_sum_ += args[parameter::keyword<Tag>::get()] * args[weight];
+            // the product goes into a member, so that vector-valued samples
+            // need no temporaries
+            this->product_ = numeric::promote<weighted_sample>(args[parameter::keyword<Tag>::get()]);
+            this->product_ *= args[weight];
+            this->weighted_sum_ += this->product_;
+        }
+
+        void merge(weighted_sum_impl const &that, dont_care)
+        {
+            this->weighted_sum_ += that.weighted_sum_;
         }
 
         result_type result(dont_care) const
@@ -65,6 +75,7 @@ namespace impl
     private:
 
         weighted_sample weighted_sum_;
+        weighted_sample product_;
     };
 
 } // namespace impl
@@ -63,6 +63,17 @@ namespace impl
 
         }
 
+        // see sum_kahan_impl::merge
+        void
+#if BOOST_ACCUMULATORS_GCC_VERSION > 40305
+        __attribute__((__optimize__("no-associative-math")))
+#endif
+        merge(weighted_sum_kahan_impl const &that, dont_care)
+        {
+            this->add(that.weighted_sum_);
+            this->add(-that.compensation);
+        }
+
         result_type result(dont_care) const
         {
             return this->weighted_sum_;
@@ -77,6 +88,18 @@ namespace impl
         }
 
     private:
+        void
+#if BOOST_ACCUMULATORS_GCC_VERSION > 40305
+        __attribute__((__optimize__("no-associative-math")))
+#endif
+        add(weighted_sample const &value)
+        {
+            const weighted_sample myTmp1 = value - this->compensation;
+            const weighted_sample myTmp2 = this->weighted_sum_ + myTmp1;
+            this->compensation = (myTmp2 - this->weighted_sum_) - myTmp1;
+            this->weighted_sum_ = myTmp2;
+        }
+
         weighted_sample weighted_sum_;
         weighted_sample compensation;
     };
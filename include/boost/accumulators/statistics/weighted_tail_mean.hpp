@@ -88,6 +88,9 @@ namespace impl
 
         non_coherent_weighted_tail_mean_impl(dont_care) {}
 
+        // the result is computed from the merged sum of weights and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -114,6 +114,9 @@ namespace impl
 
         weighted_tail_variate_means_impl(dont_care) {}
 
+        // the result is computed from the merged sum of weights and tail
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// weighted_tdigest.hpp
+//
+//  Copyright 2026 the Boost.Accumulators contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ACCUMULATORS_STATISTICS_WEIGHTED_TDIGEST_HPP
+#define BOOST_ACCUMULATORS_STATISTICS_WEIGHTED_TDIGEST_HPP
+
+#include <boost/mpl/placeholders.hpp>
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/statistics_fwd.hpp>
+#include <boost/accumulators/statistics/tdigest.hpp> // for tdigest_impl and the named parameter tdigest_compression
+
+namespace boost { namespace accumulators
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// tag::weighted_tdigest
+// tag::weighted_tdigest_quantile
+// tag::weighted_tdigest_cdf
+//
+namespace tag
+{
+    struct weighted_tdigest
+      : depends_on<>
+      , tdigest_compression
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_impl<mpl::_1, mpl::_2> impl;
+    };
+    struct weighted_tdigest_quantile
+      : depends_on<weighted_tdigest>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_quantile_impl<mpl::_1> impl;
+    };
+    struct weighted_tdigest_cdf
+      : depends_on<weighted_tdigest>
+    {
+        /// INTERNAL ONLY
+        ///
+        typedef accumulators::impl::tdigest_cdf_impl<mpl::_1> impl;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// extract::weighted_tdigest
+// extract::weighted_tdigest_quantile
+// extract::weighted_tdigest_cdf
+//
+namespace extract
+{
+    extractor<tag::weighted_tdigest> const weighted_tdigest = {};
+    extractor<tag::weighted_tdigest_quantile> const weighted_tdigest_quantile = {};
+    extractor<tag::weighted_tdigest_cdf> const weighted_tdigest_cdf = {};
+
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(weighted_tdigest)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(weighted_tdigest_quantile)
+    BOOST_ACCUMULATORS_IGNORE_GLOBAL(weighted_tdigest_cdf)
+}
+
+using extract::weighted_tdigest;
+using extract::weighted_tdigest_quantile;
+using extract::weighted_tdigest_cdf;
+
+}} // namespace boost::accumulators
+
+#endif
@@ -13,6 +13,8 @@
 #include <boost/accumulators/framework/extractor.hpp>
 #include <boost/accumulators/numeric/functional.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/accumulators/framework/parameters/accumulator.hpp>
+#include <boost/accumulators/framework/parameters/merged_accumulator.hpp>
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
 #include <boost/accumulators/statistics/count.hpp>
@@ -45,6 +47,9 @@ namespace impl
 
         lazy_weighted_variance_impl(dont_care) {}
 
+        // the result is computed from the merged weighted_moment<2> and weighted_mean
+        void merge(dont_care, dont_care) {}
+
         template<typename Args>
         result_type result(Args const &args) const
         {
@@ -78,6 +83,7 @@ namespace impl
         template<typename Args>
         weighted_variance_impl(Args const &args)
           : weighted_variance(numeric::fdiv(args[sample | Sample()], numeric::one<Weight>::value))
+          , deviation(weighted_variance)
         {
         }
 
@@ -88,13 +94,43 @@ namespace impl
 
             if(cnt > 1)
             {
-                extractor<MeanFeature> const some_mean = {};
-
-                result_type tmp = args[parameter::keyword<Tag>::get()] - some_mean(args);
+                Weight w_sum = sum_of_weights(args);
+                Weight w = args[weight];
+
+                // updated in place, with the deviation from the mean kept in a
+                // member, so that vector-valued samples need no temporaries
+                this->deviation = find_accumulator<MeanFeature>(args[accumulator]).result(args);
+                this->deviation -= args[parameter::keyword<Tag>::get()];
+                this->deviation *= this->deviation;
+                this->deviation *= w;
+                this->deviation /= w_sum - w;
+                this->weighted_variance *= w_sum - w;
+                this->weighted_variance /= w_sum;
+                this->weighted_variance += this->deviation;
+            }
+        }
 
+        /// Merges the variance of another weighted sample set, with the sums of
+        /// weights \f$\bar{w}_a\f$ and \f$\bar{w}_b\f$ taking the place of the
+        /// counts in variance_impl::merge.
+        template<typename Args>
+        void merge(weighted_variance_impl const &that, Args const &args)
+        {
+            // count, sum_of_weights and the mean are merged after this
+            if(0 == count(args))
+            {
+                this->weighted_variance = that.weighted_variance;
+            }
+            else if(0 != count(args[merged_accumulator]))
+            {
+                extractor<MeanFeature> const some_mean = {};
+                result_type tmp = some_mean(args[merged_accumulator]) - some_mean(args);
+                Weight w_sum = sum_of_weights(args);
+                Weight that_w_sum = sum_of_weights(args[merged_accumulator]);
+                Weight w = w_sum + that_w_sum;
                 this->weighted_variance =
-                    numeric::fdiv(this->weighted_variance * (sum_of_weights(args) - args[weight]), sum_of_weights(args))
-                  + numeric::fdiv(tmp * tmp * args[weight], sum_of_weights(args) - args[weight] );
+                    numeric::fdiv(this->weighted_variance * w_sum + that.weighted_variance * that_w_sum, w)
+                  + numeric::fdiv(numeric::fdiv(tmp * tmp * w_sum, w) * that_w_sum, w);
             }
         }
 
@@ -112,6 +148,7 @@ namespace impl
 
     private:
         result_type weighted_variance;
+        result_type deviation;
     };
 
 } // namespace impl
@@ -64,15 +64,25 @@ namespace tag
 
     ///////////////////////////////////////////////////////////////////////////////
     // Statistic tags
+    struct atomic_count;
+    struct atomic_max;
+    struct atomic_min;
+    struct atomic_sum;
     struct count;
     template<typename VariateType, typename VariateTag>
     struct covariance;
     struct density;
+    struct adaptive_density;
     template<typename Feature>
     struct error_of;
     struct extended_p_square;
     struct extended_p_square_quantile;
     struct extended_p_square_quantile_quadratic;
+    struct hdr_histogram;
+    struct hdr_quantile;
+    struct hdr_cdf;
+    struct kll;
+    struct kll_quantile;
     struct kurtosis;
     struct max;
     struct mean;
@@ -89,6 +99,7 @@ namespace tag
     struct min;
     template<int N>
     struct moment;
+    struct packed_covariance;
     template<typename LeftRight>
     struct peaks_over_threshold;
     template<typename LeftRight>
@@ -104,6 +115,8 @@ namespace tag
     struct p_square_cumulative_distribution;
     struct p_square_quantile;
     struct p_square_quantile_for_median;
+    struct relative_kll;
+    struct relative_kll_quantile;
     struct skewness;
     struct sum;
     struct sum_of_weights;
@@ -116,6 +129,8 @@ namespace tag
     template<typename LeftRight>
     struct tail;
     template<typename LeftRight>
+    struct buffered_tail;
+    template<typename LeftRight>
     struct coherent_tail_mean;
     template<typename LeftRight>
     struct non_coherent_tail_mean;
@@ -135,6 +150,9 @@ namespace tag
     struct absolute_tail_variate_means;
     template<typename LeftRight, typename VariateType, typename VariateTag>
     struct relative_tail_variate_means;
+    struct tdigest;
+    struct tdigest_quantile;
+    struct tdigest_cdf;
     struct lazy_variance;
     struct variance;
     template<typename VariateType, typename VariateTag>
@@ -183,6 +201,9 @@ namespace tag
     struct absolute_weighted_tail_variate_means;
     template<typename LeftRight, typename VariateType, typename VariateTag>
     struct relative_weighted_tail_variate_means;
+    struct weighted_tdigest;
+    struct weighted_tdigest_quantile;
+    struct weighted_tdigest_cdf;
     struct lazy_weighted_variance;
     struct weighted_variance;
     struct weighted_sum;
@@ -193,12 +214,45 @@ namespace tag
     struct rolling_sum;
     struct rolling_count;
     struct rolling_mean;
+    struct rolling_min;
+    struct rolling_max;
+    struct rolling_quantile;
+    struct rolling_median;
+    template<typename Timestamp = double>
+    struct timed_rolling_window_plus1;
+    template<typename Timestamp = double>
+    struct timed_rolling_window;
+    template<typename Feature>
+    struct rolling;
+    struct ew_count;
+    template<typename Timestamp = double>
+    struct timed_ew_count;
+    struct ewma;
+    struct ew_variance;
+    template<typename VariateType, typename VariateTag>
+    struct ew_covariance;
+    struct abstract_ew_covariance;
+    struct multi_rolling_count;
+    struct multi_rolling_sum;
+    struct multi_rolling_mean;
+    struct multi_rolling_variance;
 } // namespace tag
 
 namespace impl
 {
     ///////////////////////////////////////////////////////////////////////////////
     // Statistics impls
+    struct atomic_count_impl;
+
+    template<typename Sample>
+    struct atomic_max_impl;
+
+    template<typename Sample>
+    struct atomic_min_impl;
+
+    template<typename Sample>
+    struct atomic_sum_impl;
+
     struct count_impl;
 
     template<typename Sample, typename VariateType, typename VariateTag>
@@ -207,6 +261,9 @@ namespace impl
     template<typename Sample>
     struct density_impl;
 
+    template<typename Sample>
+    struct adaptive_density_impl;
+
     template<typename Sample, typename Feature>
     struct error_of_impl;
 
@@ -219,6 +276,21 @@ namespace impl
     template<typename Sample, typename Impl1, typename Impl2>
     struct extended_p_square_quantile_impl;
 
+    template<typename Sample>
+    struct hdr_histogram_impl;
+
+    template<typename Sample>
+    struct hdr_quantile_impl;
+
+    template<typename Sample>
+    struct hdr_cdf_impl;
+
+    template<typename Sample, typename ErrorMode>
+    struct kll_impl;
+
+    template<typename Sample>
+    struct kll_quantile_impl;
+
     template<typename Sample>
     struct kurtosis_impl;
 
@@ -246,6 +318,9 @@ namespace impl
     template<typename N, typename Sample>
     struct moment_impl;
 
+    template<typename Sample>
+    struct packed_covariance_impl;
+
     template<typename Sample, typename LeftRight>
     struct peaks_over_threshold_prob_impl;
 
@@ -273,6 +348,9 @@ namespace impl
     template<typename Sample, typename LeftRight>
     struct tail_impl;
 
+    template<typename Sample, typename LeftRight>
+    struct buffered_tail_impl;
+
     template<typename Sample, typename LeftRight>
     struct coherent_tail_mean_impl;
 
@@ -288,6 +366,15 @@ namespace impl
     template<typename Sample, typename Impl, typename LeftRight, typename VariateTag>
     struct tail_variate_means_impl;
 
+    template<typename Sample, typename Weight>
+    struct tdigest_impl;
+
+    template<typename Sample>
+    struct tdigest_quantile_impl;
+
+    template<typename Sample>
+    struct tdigest_cdf_impl;
+
     template<typename Sample, typename MeanFeature>
     struct lazy_variance_impl;
 
@@ -377,6 +464,51 @@ namespace impl
 
     template<typename Sample>
     struct rolling_mean_impl;
+
+    template<typename Sample>
+    struct rolling_min_impl;
+
+    template<typename Sample>
+    struct rolling_max_impl;
+
+    template<typename Sample, typename Impl>
+    struct rolling_quantile_impl;
+
+    template<typename Sample, typename Timestamp>
+    struct timed_rolling_window_plus1_impl;
+
+    template<typename Sample, typename Timestamp>
+    struct timed_rolling_window_impl;
+
+    template<typename Sample, typename Feature>
+    struct rolling_impl;
+
+    template<typename Sample>
+    struct ew_count_impl;
+
+    template<typename Sample, typename Timestamp>
+    struct timed_ew_count_impl;
+
+    template<typename Sample>
+    struct ewma_impl;
+
+    template<typename Sample>
+    struct ew_variance_impl;
+
+    template<typename Sample, typename VariateType, typename VariateTag>
+    struct ew_covariance_impl;
+
+    template<typename Sample>
+    struct multi_rolling_count_impl;
+
+    template<typename Sample>
+    struct multi_rolling_sum_impl;
+
+    template<typename Sample>
+    struct multi_rolling_mean_impl;
+
+    template<typename Sample>
+    struct multi_rolling_variance_impl;
 } // namespace impl
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -427,6 +559,10 @@ struct for_median {};
 // modifier for sum_kahan, sum_of_weights_kahan, sum_of_variates_kahan, weighted_sum_kahan
 struct kahan {};
 
+// modifiers for kll and kll_quantile
+struct additive_error {};
+struct relative_error {};
+
 }} // namespace boost::accumulators
 
 #endif
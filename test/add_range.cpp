@@ -0,0 +1,167 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <list>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/moment.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+typedef stats<tag::count, tag::sum, tag::min, tag::max, tag::mean, tag::moment<2> > range_aware_stats;
+
+typedef accumulator_set<double, range_aware_stats> range_aware_set;
+typedef accumulator_set<double, stats<tag::mean(immediate)> > per_sample_set;
+
+BOOST_MPL_ASSERT((accumulators::detail::all_range_aware<range_aware_set::accumulators_mpl_vector>));
+BOOST_MPL_ASSERT_NOT((accumulators::detail::all_range_aware<per_sample_set::accumulators_mpl_vector>));
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    std::vector<double> data;
+    for(int i = 0; i < 1000; ++i)
+    {
+        data.push_back((i % 7) * 1.5 - (i % 11));
+    }
+
+    range_aware_set acc, acc2;
+
+    // feed the data in two blocks
+    acc.add_range(data.begin(), data.begin() + 300);
+    acc.add_range(data.begin() + 300, data.end());
+
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        acc2(data[i]);
+    }
+
+    BOOST_CHECK_EQUAL(count(acc2), count(acc));
+    BOOST_CHECK_CLOSE(sum(acc2), sum(acc), 1e-10);
+    BOOST_CHECK_EQUAL((min)(acc2), (min)(acc));
+    BOOST_CHECK_EQUAL((max)(acc2), (max)(acc));
+    BOOST_CHECK_CLOSE(mean(acc2), mean(acc), 1e-10);
+    BOOST_CHECK_CLOSE(accumulators::moment<2>(acc2), accumulators::moment<2>(acc), 1e-10);
+
+    // an empty block is a no-op
+    acc.add_range(data.end(), data.end());
+    BOOST_CHECK_EQUAL(1000u, count(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_block_kernels
+//   contiguous float and double blocks go through the multi-lane kernels
+//
+template<typename T>
+void test_block_kernels_for()
+{
+    typedef accumulator_set<T, stats<tag::sum, tag::min, tag::max, tag::moment<3> > > acc_type;
+
+    std::vector<T> data;
+    unsigned int seed = 42;
+    for(int i = 0; i < 1237; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data.push_back(static_cast<T>((seed >> 8) % 20001) / T(1000) - T(10));
+    }
+
+    // exercise every remainder modulo the lane count, and the empty block
+    for(std::size_t n = 0; n <= data.size(); n += (n < 40 ? 1 : 397))
+    {
+        acc_type acc, acc2;
+        acc.add_range(data.begin(), data.begin() + n);
+        acc.add_range(&data[0], &data[0] + n);
+        for(std::size_t i = 0; i < 2 * n; ++i)
+        {
+            acc2(data[i % n]);
+        }
+
+        BOOST_CHECK_EQUAL((min)(acc2), (min)(acc));
+        BOOST_CHECK_EQUAL((max)(acc2), (max)(acc));
+        if(0 != n)
+        {
+            T const tolerance = sizeof(T) == sizeof(float) ? T(1e-2) : T(1e-9);
+            BOOST_CHECK_CLOSE(sum(acc2), sum(acc), tolerance);
+            BOOST_CHECK_CLOSE(accumulators::moment<3>(acc2), accumulators::moment<3>(acc), tolerance);
+        }
+    }
+}
+
+void test_block_kernels()
+{
+    BOOST_MPL_ASSERT((numeric::detail::has_block_kernel<std::vector<double>::const_iterator, double>));
+    BOOST_MPL_ASSERT((numeric::detail::has_block_kernel<float *, float>));
+    BOOST_MPL_ASSERT_NOT((numeric::detail::has_block_kernel<std::list<double>::iterator, double>));
+    BOOST_MPL_ASSERT_NOT((numeric::detail::has_block_kernel<int *, int>));
+
+    test_block_kernels_for<float>();
+    test_block_kernels_for<double>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_fallback
+//
+void test_fallback()
+{
+    std::list<int> data;
+    data.push_back(1);
+    data.push_back(2);
+    data.push_back(4);
+
+    // immediate_mean and variance need to see count after every sample, so
+    // the block is pushed through one sample at a time.
+    accumulator_set<int, stats<tag::mean(immediate), tag::variance, tag::max> > acc;
+    acc.add_range(data);
+
+    BOOST_CHECK_EQUAL(3u, count(acc));
+    BOOST_CHECK_CLOSE(7./3., mean(acc), 1e-5);
+    BOOST_CHECK_CLOSE(14./9., variance(acc), 1e-5);
+    BOOST_CHECK_EQUAL(4, (max)(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_droppable
+//
+void test_droppable()
+{
+    int const data[] = {1, 2, 3, 4};
+
+    accumulator_set<int, stats<droppable<tag::sum>, tag::count> > acc;
+    acc.add_range(data);
+    BOOST_CHECK_EQUAL(10, sum(acc));
+
+    acc.drop<tag::sum>();
+    acc.add_range(data);
+    BOOST_CHECK_EQUAL(10, sum(acc));
+    BOOST_CHECK_EQUAL(8u, count(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("add_range test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_block_kernels));
+    test->add(BOOST_TEST_CASE(&test_fallback));
+    test->add(BOOST_TEST_CASE(&test_droppable));
+
+    return test;
+}
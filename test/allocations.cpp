@@ -0,0 +1,148 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for the accumulators that update their state in place, checked
+// by counting the allocations of the whole program. The other tests keep the
+// default allocator.
+
+#define BOOST_NUMERIC_FUNCTIONAL_STD_VECTOR_SUPPORT
+
+#include <new>
+#include <vector>
+#include <cstdlib>
+#include <boost/config.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/numeric/functional/vector.hpp>
+#include <boost/accumulators/statistics/covariance.hpp>
+#include <boost/accumulators/statistics/moment.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/weighted_moment.hpp>
+#include <boost/accumulators/statistics/weighted_variance.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+namespace
+{
+    std::size_t allocations = 0;
+
+    // the number of allocations made since it was constructed
+    struct allocation_counter
+    {
+        allocation_counter()
+          : before(allocations)
+        {
+        }
+
+        std::size_t count() const
+        {
+            return allocations - this->before;
+        }
+
+    private:
+        std::size_t before;
+    };
+}
+
+namespace
+{
+    // The replacements below go through these, which are not inlined: GCC would
+    // otherwise see the malloc of operator new freed in operator delete, and
+    // report it with -Wmismatched-new-delete.
+    BOOST_NOINLINE void *allocate(std::size_t size)
+    {
+        ++allocations;
+        if(void *p = std::malloc(size ? size : 1))
+        {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    BOOST_NOINLINE void deallocate(void *p)
+    {
+        std::free(p);
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void *p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    deallocate(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, std::size_t) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    deallocate(p);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// test_packed_covariance
+//   packed_covariance allocates for the first sample only
+//
+void test_packed_covariance()
+{
+    std::vector<double> x(5, 1.);
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > packed;
+    packed(x);
+
+    allocation_counter counter;
+    for(int i = 0; i < 100; ++i)
+    {
+        for(std::size_t j = 0; j < x.size(); ++j)
+        {
+            x[j] = (i * (j + 1)) % 7 - 0.5 * j;
+        }
+        packed(x);
+    }
+    BOOST_CHECK_EQUAL(0u, counter.count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_vector
+//   the statistics of vector samples are updated in place
+//
+void test_vector()
+{
+    typedef std::vector<double> sample_t;
+
+    sample_t x(3, 0.);
+    accumulator_set<sample_t, stats<tag::variance, tag::moment<3> > > acc(sample = x);
+    accumulator_set<sample_t, stats<tag::weighted_sum, tag::weighted_variance, tag::weighted_moment<3> >, double> wacc(sample = x);
+
+    allocation_counter counter;
+    for(int i = 0; i < 100; ++i)
+    {
+        for(std::size_t j = 0; j < x.size(); ++j)
+        {
+            x[j] = (i * (j + 1)) % 17 - 0.5 * j;
+        }
+        acc(x);
+        wacc(x, weight = 1. + i % 3);
+    }
+    BOOST_CHECK_EQUAL(0u, counter.count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("allocations test");
+
+    test->add(BOOST_TEST_CASE(&test_packed_covariance));
+    test->add(BOOST_TEST_CASE(&test_vector));
+
+    return test;
+}
@@ -0,0 +1,191 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for boost::array and std::array samples
+
+#define BOOST_NUMERIC_FUNCTIONAL_STD_ARRAY_SUPPORT
+#define BOOST_NUMERIC_FUNCTIONAL_STD_VECTOR_SUPPORT
+
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/config.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/moment.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/weighted_mean.hpp>
+#include <boost/accumulators/statistics/covariance.hpp>
+#include <boost/accumulators/statistics/variates/covariate.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ARRAY
+# include <array>
+#endif
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+// the i-th sample of a sequence with different statistics in each element
+template<typename Array>
+Array make_sample(int i)
+{
+    Array x;
+    for(std::size_t j = 0; j < x.size(); ++j)
+    {
+        x[j] = static_cast<typename Array::value_type>((i * (j + 3)) % 11 - 2 * j);
+    }
+    return x;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// check_stat
+//   the statistics of the array samples are those of their elements
+//
+template<typename Array>
+void check_stat()
+{
+    typedef typename Array::value_type value_type;
+    std::size_t const size = Array().size();
+
+    accumulator_set<Array, stats<tag::sum, tag::min, tag::max, tag::moment<2>, tag::variance> > acc;
+    accumulator_set<Array, stats<tag::weighted_mean>, double> wacc;
+    accumulator_set<value_type, stats<tag::sum, tag::min, tag::max, tag::moment<2>, tag::variance> > elements[8];
+    accumulator_set<value_type, stats<tag::weighted_mean>, double> weighted_elements[8];
+
+    for(int i = 0; i < 50; ++i)
+    {
+        Array x = make_sample<Array>(i);
+        acc(x);
+        wacc(x, weight = 1. + i % 4);
+        for(std::size_t j = 0; j < size; ++j)
+        {
+            elements[j](x[j]);
+            weighted_elements[j](x[j], weight = 1. + i % 4);
+        }
+    }
+
+    for(std::size_t j = 0; j < size; ++j)
+    {
+        BOOST_CHECK_EQUAL(sum(elements[j]), sum(acc)[j]);
+        BOOST_CHECK_EQUAL((min)(elements[j]), (min)(acc)[j]);
+        BOOST_CHECK_EQUAL((max)(elements[j]), (max)(acc)[j]);
+        BOOST_CHECK_EQUAL(mean(elements[j]), mean(acc)[j]);
+        BOOST_CHECK_EQUAL(moment<2>(elements[j]), moment<2>(acc)[j]);
+        BOOST_CHECK_EQUAL(variance(elements[j]), variance(acc)[j]);
+        BOOST_CHECK_EQUAL(weighted_mean(weighted_elements[j]), weighted_mean(wacc)[j]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// check_covariance
+//   the covariance matrix of array samples is that of the same samples in
+//   std::vector
+//
+template<typename Array>
+void check_covariance()
+{
+    typedef std::vector<double> vector_type;
+    std::size_t const size = Array().size();
+
+    accumulator_set<Array, stats<tag::covariance<Array, tag::covariate1> > > acc;
+    accumulator_set<Array, stats<tag::packed_covariance> > packed;
+    vector_type zero(size, 0.);
+    accumulator_set<vector_type, stats<tag::covariance<vector_type, tag::covariate1> > > reference(sample = zero, covariate1 = zero);
+
+    for(int i = 0; i < 50; ++i)
+    {
+        Array x = make_sample<Array>(i);
+        vector_type v(x.begin(), x.end());
+        acc(x, covariate1 = x);
+        packed(x);
+        reference(v, covariate1 = v);
+    }
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        for(std::size_t j = 0; j < size; ++j)
+        {
+            BOOST_CHECK_CLOSE(covariance(reference)(i, j), covariance(acc)(i, j), 1e-10);
+            BOOST_CHECK_CLOSE(covariance(reference)(i, j), covariance(packed)(i, j), 1e-10);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_operators
+//
+void test_operators()
+{
+    using namespace numeric::operators;
+
+    boost::array<int, 3> a = {{1, 2, 3}};
+    boost::array<double, 3> b = {{0.5, 1.5, 2.5}};
+
+    boost::array<double, 3> c = a + b;
+    BOOST_CHECK_EQUAL(1.5, c[0]);
+    BOOST_CHECK_EQUAL(5.5, c[2]);
+
+    c = b * 2;
+    BOOST_CHECK_EQUAL(3., c[1]);
+    c = 2. * b - a;
+    BOOST_CHECK_EQUAL(0., c[0]);
+    BOOST_CHECK_EQUAL(2., c[2]);
+
+    c = b;
+    c *= c;
+    c /= 0.25;
+    c -= a;
+    BOOST_CHECK_EQUAL(0., c[0]);
+    BOOST_CHECK_EQUAL(22., c[2]);
+
+    // integral division in fdiv is floating-point
+    boost::array<double, 3> d = numeric::fdiv(a, 2);
+    BOOST_CHECK_EQUAL(0.5, d[0]);
+    BOOST_CHECK_EQUAL(-2, (-a)[1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_boost_array
+//
+void test_boost_array()
+{
+    check_stat<boost::array<double, 3> >();
+    check_stat<boost::array<double, 4> >();
+    check_stat<boost::array<float, 8> >();
+    check_stat<boost::array<int, 3> >();
+    check_covariance<boost::array<double, 4> >();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_std_array
+//
+void test_std_array()
+{
+#ifndef BOOST_NO_CXX11_HDR_ARRAY
+    check_stat<std::array<double, 3> >();
+    check_stat<std::array<double, 8> >();
+    check_covariance<std::array<double, 3> >();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("array test");
+
+    test->add(BOOST_TEST_CASE(&test_operators));
+    test->add(BOOST_TEST_CASE(&test_boost_array));
+    test->add(BOOST_TEST_CASE(&test_std_array));
+
+    return test;
+}
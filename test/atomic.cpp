@@ -0,0 +1,122 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/atomic_count.hpp>
+#include <boost/accumulators/statistics/atomic_sum.hpp>
+#include <boost/accumulators/statistics/atomic_min.hpp>
+#include <boost/accumulators/statistics/atomic_max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+#include <thread>
+
+// mean depends on count and sum, which the atomic features provide
+typedef accumulator_set<
+    double
+  , stats<tag::atomic_count, tag::atomic_sum, tag::atomic_min, tag::atomic_max, tag::mean>
+> acc_type;
+
+typedef acc_type::apply<tag::count>::type count_accumulator;
+typedef acc_type::apply<tag::sum>::type sum_accumulator;
+BOOST_MPL_ASSERT((is_base_of<impl::atomic_count_impl, count_accumulator>));
+BOOST_MPL_ASSERT((is_base_of<impl::atomic_sum_impl<double>, sum_accumulator>));
+
+struct pusher
+{
+    acc_type *acc;
+    int first;
+
+    void operator ()() const
+    {
+        for(int i = this->first; i < this->first + 10000; ++i)
+        {
+            (*this->acc)(static_cast<double>(i));
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//   8 threads push 0, 1, ..., 79999 into a single set
+//
+void test_stat()
+{
+    acc_type acc;
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 8; ++i)
+    {
+        pusher p = {&acc, i * 10000};
+        threads.push_back(std::thread(p));
+    }
+    for(std::size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    BOOST_CHECK_EQUAL(80000u, count(acc));
+    BOOST_CHECK_EQUAL(79999. * 40000., sum(acc));
+    BOOST_CHECK_EQUAL(0., (min)(acc));
+    BOOST_CHECK_EQUAL(79999., (max)(acc));
+    BOOST_CHECK_CLOSE(39999.5, mean(acc), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_range_and_merge
+//
+void test_range_and_merge()
+{
+    std::vector<int> data;
+    for(int i = -5; i < 100; ++i)
+    {
+        data.push_back(i);
+    }
+
+    accumulator_set<int, stats<tag::atomic_count, tag::atomic_sum, tag::atomic_min, tag::atomic_max> > acc, acc2;
+    acc.add_range(data);
+    acc2(1000);
+    acc2(-1000);
+
+    BOOST_CHECK_EQUAL(105u, count(acc));
+    BOOST_CHECK_EQUAL(4935, sum(acc));
+    BOOST_CHECK_EQUAL(-5, (min)(acc));
+    BOOST_CHECK_EQUAL(99, (max)(acc));
+
+    acc.merge(acc2);
+    BOOST_CHECK_EQUAL(107u, count(acc));
+    BOOST_CHECK_EQUAL(4935, sum(acc));
+    BOOST_CHECK_EQUAL(-1000, (min)(acc));
+    BOOST_CHECK_EQUAL(1000, (max)(acc));
+}
+
+#else
+
+void test_stat() {}
+void test_range_and_merge() {}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("atomic test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_range_and_merge));
+
+    return test;
+}
@@ -0,0 +1,291 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/framework/concurrent_accumulator_set.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/weighted_mean.hpp>
+#include <boost/accumulators/statistics/tail.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+#ifdef BOOST_ACCUMULATORS_HAS_CONCURRENT_ACCUMULATOR_SET
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+// the number of samples that reached a rendezvous accumulator, and the number
+// of them that found another one there before giving up
+std::atomic<int> arrivals(0);
+std::atomic<int> meetings(0);
+
+namespace boost { namespace accumulators
+{
+namespace impl
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // rendezvous_impl
+    //   waits inside the shard's lock until two samples are being pushed at
+    //   once, which they only can be into different shards
+    template<typename Sample>
+    struct rendezvous_impl
+      : accumulator_base
+    {
+        typedef int result_type;
+
+        rendezvous_impl(dont_care)
+        {}
+
+        void operator ()(dont_care)
+        {
+            ++arrivals;
+            std::chrono::steady_clock::time_point const deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while(arrivals < 2 && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+            if(arrivals >= 2)
+            {
+                ++meetings;
+            }
+        }
+
+        result_type result(dont_care) const
+        {
+            return meetings;
+        }
+    };
+}
+
+namespace tag
+{
+    struct rendezvous
+      : depends_on<>
+    {
+        typedef accumulators::impl::rendezvous_impl< mpl::_1 > impl;
+    };
+}
+}}
+
+typedef concurrent_accumulator_set<double, stats<tag::sum, tag::min, tag::max, tag::mean, tag::variance> > acc_type;
+
+struct pusher
+{
+    acc_type *acc;
+    int first;
+
+    void operator ()() const
+    {
+        for(int i = this->first; i < this->first + 10000; ++i)
+        {
+            (*this->acc)(i);
+        }
+    }
+};
+
+struct reader
+{
+    acc_type *acc;
+
+    void operator ()() const
+    {
+        std::size_t last = 0;
+        for(int i = 0; i < 100; ++i)
+        {
+            // the count never goes backwards
+            std::size_t cnt = count(*this->acc);
+            BOOST_CHECK_LE(last, cnt);
+            last = cnt;
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//   8 threads push 0, 1, ..., 79999 while another one extracts
+//
+void test_stat()
+{
+    acc_type acc(3);
+    BOOST_CHECK_EQUAL(3u, acc.shard_count());
+
+    std::vector<std::thread> threads;
+    reader r = {&acc};
+    threads.push_back(std::thread(r));
+    for(int i = 0; i < 8; ++i)
+    {
+        pusher p = {&acc, i * 10000};
+        threads.push_back(std::thread(p));
+    }
+    for(std::size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    BOOST_CHECK_EQUAL(80000u, count(acc));
+    BOOST_CHECK_EQUAL(79999. * 40000., sum(acc));
+    BOOST_CHECK_EQUAL(0., (min)(acc));
+    BOOST_CHECK_EQUAL(79999., (max)(acc));
+    BOOST_CHECK_CLOSE(39999.5, mean(acc), 1e-10);
+    BOOST_CHECK_CLOSE((80000. * 80000. - 1.) / 12., variance(acc), 1e-8);
+
+    std::vector<double> block(10, 80000.);
+    acc.add_range(block);
+
+    acc_type::accumulator_set_type merged = acc.snapshot();
+    BOOST_CHECK_EQUAL(80010u, count(merged));
+    BOOST_CHECK_EQUAL(80000., (max)(merged));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_weighted
+//
+void test_weighted()
+{
+    concurrent_accumulator_set<double, stats<tag::weighted_mean>, double> acc;
+    acc(1., weight = 3.);
+    acc(5., weight = 1.);
+
+    BOOST_CHECK_CLOSE(4., sum_of_weights(acc), 1e-10);
+    BOOST_CHECK_CLOSE(8. / 4., weighted_mean(acc), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_range
+//   a range extracted from the shards keeps the merged set it points into
+//
+void test_range()
+{
+    typedef accumulator_set<int, stats<tag::tail<right> > > shard_type;
+    typedef concurrent_accumulator_set<int, stats<tag::tail<right> > > tail_acc_type;
+
+    tail_acc_type acc(shard_type(right_tail_cache_size = 3), 2);
+    for(int i = 0; i < 10; ++i)
+    {
+        acc((i * 7) % 10);
+    }
+
+    typedef tail_acc_type::apply<tag::tail<right> >::type::result_type range_type;
+    range_type rng = tail(acc);
+
+    // later samples do not change the extracted range
+    acc(20);
+    acc(30);
+    range_type last = tail(acc);
+    std::vector<int> kept(rng.begin(), rng.end());
+    std::vector<int> later(last.begin(), last.end());
+
+    BOOST_REQUIRE_EQUAL(3u, kept.size());
+    BOOST_CHECK_EQUAL(9, kept[0]);
+    BOOST_CHECK_EQUAL(8, kept[1]);
+    BOOST_CHECK_EQUAL(7, kept[2]);
+    BOOST_REQUIRE_EQUAL(3u, later.size());
+    BOOST_CHECK_EQUAL(30, later[0]);
+    BOOST_CHECK_EQUAL(20, later[1]);
+    BOOST_CHECK_EQUAL(9, later[2]);
+}
+
+typedef concurrent_accumulator_set<int, stats<tag::count> > other_acc_type;
+typedef concurrent_accumulator_set<int, stats<tag::rendezvous> > rendezvous_acc_type;
+
+struct other_pusher
+{
+    other_acc_type *other;
+
+    void operator ()() const
+    {
+        (*this->other)(0);
+    }
+};
+
+struct meeter
+{
+    other_acc_type *other;
+    rendezvous_acc_type *acc;
+    std::atomic<bool> *ready;
+    std::atomic<bool> *go;
+
+    void operator ()() const
+    {
+        // push into another set first, as other threads of the program might
+        (*this->other)(0);
+        *this->ready = true;
+        while(!*this->go)
+        {
+            std::this_thread::yield();
+        }
+        (*this->acc)(0);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// test_shards
+//   two threads pushing into a set of two shards do not share one, whatever
+//   threads pushed into other sets before
+//
+void test_shards()
+{
+    other_acc_type other(1);
+    rendezvous_acc_type acc(2);
+    std::atomic<bool> ready1(false), ready2(false), go(false);
+
+    meeter m1 = {&other, &acc, &ready1, &go};
+    std::thread t1(m1);
+    while(!ready1)
+    {
+        std::this_thread::yield();
+    }
+    other_pusher p = {&other};
+    std::thread(p).join();
+    meeter m2 = {&other, &acc, &ready2, &go};
+    std::thread t2(m2);
+    while(!ready2)
+    {
+        std::this_thread::yield();
+    }
+
+    go = true;
+    t1.join();
+    t2.join();
+    BOOST_CHECK_EQUAL(2, meetings);
+    BOOST_CHECK_EQUAL(3u, count(other));
+}
+
+#else
+
+void test_shards() {}
+void test_stat() {}
+void test_weighted() {}
+void test_range() {}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("concurrent_accumulator_set test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_weighted));
+    test->add(BOOST_TEST_CASE(&test_range));
+    test->add(BOOST_TEST_CASE(&test_shards));
+
+    return test;
+}
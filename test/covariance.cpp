@@ -5,6 +5,7 @@
 
 #define BOOST_NUMERIC_FUNCTIONAL_STD_VECTOR_SUPPORT
 
+#include <boost/random.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/accumulators/accumulators.hpp>
@@ -121,6 +122,115 @@ void test_persistency()
 
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// test_packed
+//   packed_covariance is the covariance of the samples with themselves
+//
+void test_packed()
+{
+    boost::lagged_fibonacci607 rng;
+
+    std::vector<std::vector<double> > samples(1000, std::vector<double>(5));
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        for (std::size_t j = 0; j < 5; ++j)
+        {
+            samples[i][j] = rng() + j * samples[i][0];
+        }
+    }
+
+    std::vector<double> dummy(5, 0.);
+    accumulator_set<std::vector<double>, stats<tag::covariance<std::vector<double>, tag::covariate1> > > acc(sample = dummy, covariate1 = dummy);
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > packed;
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > parts[3];
+
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        acc(samples[i], covariate1 = samples[i]);
+        parts[i % 3](samples[i]);
+        packed(samples[i]);
+    }
+
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > merged;
+    for (int i = 0; i < 3; ++i)
+    {
+        merged.merge(parts[i]);
+    }
+
+    // blocks of samples, shorter and longer than the internal block
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > blocks;
+    blocks.add_range(samples.begin(), samples.begin() + 10);
+    blocks.add_range(samples.begin() + 10, samples.end());
+
+    double epsilon = 1e-8;
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        for (std::size_t j = 0; j < 5; ++j)
+        {
+            BOOST_CHECK_CLOSE((covariance(acc))(i,j), (covariance(packed))(i,j), epsilon);
+            BOOST_CHECK_CLOSE((covariance(acc))(i,j), (covariance(merged))(i,j), epsilon);
+            BOOST_CHECK_CLOSE((covariance(acc))(i,j), (covariance(blocks))(i,j), epsilon);
+        }
+    }
+
+    // "persistent" storage
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        packed.serialize(oa, 0);
+    }
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > restored;
+    boost::archive::text_iarchive ia(ss);
+    restored.serialize(ia, 0);
+    restored(samples[0]);
+    packed(samples[0]);
+    BOOST_CHECK_CLOSE((covariance(packed))(1,3), (covariance(restored))(1,3), epsilon);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_packed_wide
+//   blocks of samples wider than a band of columns, in a width that is not a
+//   multiple of the rows updated at once
+//
+void test_packed_wide()
+{
+    boost::lagged_fibonacci607 rng;
+
+    std::size_t const d = 261;
+    std::vector<std::vector<double> > samples(203, std::vector<double>(d));
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        for (std::size_t j = 0; j < d; ++j)
+        {
+            samples[i][j] = rng() + (j % 7) * samples[i][0];
+        }
+    }
+
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > packed;
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        packed(samples[i]);
+    }
+
+    accumulator_set<std::vector<double>, stats<tag::packed_covariance> > blocks;
+    blocks.add_range(samples.begin(), samples.begin() + 7);
+    blocks.add_range(samples.begin() + 7, samples.begin() + 9);
+    blocks.add_range(samples.begin() + 9, samples.end());
+
+    typedef accumulator_set<std::vector<double>, stats<tag::packed_covariance> >::apply<tag::packed_covariance>::type::result_type matrix_type;
+    matrix_type const expected = covariance(packed);
+    matrix_type const actual = covariance(blocks);
+
+    double epsilon = 1e-8;
+    for (std::size_t i = 0; i < d; ++i)
+    {
+        for (std::size_t j = 0; j < d; ++j)
+        {
+            BOOST_CHECK_CLOSE(expected(i,j), actual(i,j), epsilon);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
 //
@@ -130,6 +240,8 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
 
     test->add(BOOST_TEST_CASE(&test_stat));
     test->add(BOOST_TEST_CASE(&test_persistency));
+    test->add(BOOST_TEST_CASE(&test_packed));
+    test->add(BOOST_TEST_CASE(&test_packed_wide));
 
     return test;
 }
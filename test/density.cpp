@@ -0,0 +1,379 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for density.hpp and weighted_density.hpp
+
+#include <limits>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/density.hpp>
+#include <boost/accumulators/statistics/weighted_density.hpp>
+#include <boost/accumulators/statistics/median.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace boost::accumulators;
+
+typedef accumulator_set<double, stats<tag::density> > accumulator_t;
+typedef accumulator_set<double, stats<tag::weighted_density>, double> accumulator_t_weighted;
+typedef accumulator_set<double, stats<tag::adaptive_density> > accumulator_t_adaptive;
+typedef iterator_range<std::vector<std::pair<double, double> >::iterator> histogram_type;
+
+BOOST_MPL_ASSERT((accumulators::detail::all_range_aware<accumulator_t::accumulators_mpl_vector>));
+
+// count the samples in each bin by searching the lower bounds of the bins
+template<typename Histogram>
+std::vector<double> search_bins(Histogram const &hist, std::vector<double> const &samples)
+{
+    std::vector<double> positions;
+    for (typename Histogram::const_iterator it = hist.begin(); it != hist.end(); ++it)
+    {
+        positions.push_back(it->first);
+    }
+
+    std::vector<double> counts(positions.size(), 0.);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        double x = samples[i];
+        if (x < positions[1])
+        {
+            ++counts[0];
+        }
+        else if (x >= positions.back())
+        {
+            ++counts.back();
+        }
+        else
+        {
+            ++counts[std::upper_bound(positions.begin(), positions.end(), x) - positions.begin() - 1];
+        }
+    }
+    return counts;
+}
+
+// samples from -1 to 1, and a few exactly on the bin boundaries
+std::vector<double> make_samples(std::size_t n)
+{
+    boost::lagged_fibonacci607 rng;
+    std::vector<double> samples;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        samples.push_back(2. * rng() - 1.);
+    }
+    samples[0] = -1.;
+    samples[1] = 1.;
+    for (std::size_t i = 0; i <= 100; ++i)
+    {
+        samples.push_back(-1. + i * 0.02);
+        samples.push_back(-1. + (i - 1.) * (2. / 100));
+    }
+    samples.push_back(-5.);
+    samples.push_back(5.);
+    return samples;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//   the bins computed from the bin width are the ones a search would find
+//
+void test_stat()
+{
+    std::vector<double> samples = make_samples(10000);
+
+    accumulator_t acc(density_cache_size = 1000, density_num_bins = 100);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        acc(samples[i]);
+    }
+
+    std::vector<double> counts = search_bins(density(acc), samples);
+    BOOST_CHECK_EQUAL(102u, counts.size());
+    histogram_type hist = density(acc);
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        BOOST_CHECK_CLOSE(counts[i] / samples.size(), hist[i].second, 1e-10);
+    }
+
+    // under- and overflow
+    BOOST_CHECK_LT(0., density(acc).front().second);
+    BOOST_CHECK_LT(0., density(acc).back().second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_range
+//   a block gives the same histogram as the samples one by one, also when
+//   the cache fills up in the middle of the block
+//
+void test_range()
+{
+    std::vector<double> samples = make_samples(5000);
+    samples.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    accumulator_t one_by_one(density_cache_size = 1000, density_num_bins = 100);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        one_by_one(samples[i]);
+    }
+
+    accumulator_t acc(density_cache_size = 1000, density_num_bins = 100);
+    acc.add_range(samples.begin(), samples.begin() + 700);
+    acc.add_range(samples.begin() + 700, samples.end());
+
+    BOOST_CHECK(density(one_by_one) == density(acc));
+
+    // all the samples are the same
+    accumulator_t flat(density_cache_size = 10, density_num_bins = 10);
+    std::vector<double> ones(100, 1.);
+    flat.add_range(ones);
+    BOOST_CHECK_EQUAL(1., density(flat).back().second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_weighted
+//   with unit weights, the weighted histogram is the unweighted one
+//
+void test_weighted()
+{
+    std::vector<double> samples = make_samples(10000);
+
+    accumulator_t acc(density_cache_size = 1000, density_num_bins = 100);
+    accumulator_t_weighted wacc(density_cache_size = 1000, density_num_bins = 100);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        acc(samples[i]);
+        wacc(samples[i], weight = 1.);
+    }
+
+    BOOST_CHECK(density(acc) == weighted_density(wacc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    std::vector<double> samples = make_samples(5000);
+
+    // "persistent" storage
+    std::stringstream ss;
+    {
+        accumulator_t acc(density_cache_size = 1000, density_num_bins = 100);
+        acc.add_range(samples.begin(), samples.begin() + 2000);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(density_cache_size = 1000, density_num_bins = 100);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    acc.add_range(samples.begin() + 2000, samples.end());
+
+    accumulator_t one_by_one(density_cache_size = 1000, density_num_bins = 100);
+    one_by_one.add_range(samples);
+    BOOST_CHECK(density(one_by_one) == density(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_adaptive
+//   the bins follow samples drifting away from the first ones, without
+//   under- or overflow, and hold the samples a search would find
+//
+void test_adaptive()
+{
+    boost::lagged_fibonacci607 rng;
+    std::vector<double> samples;
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        samples.push_back(0.01 * i + rng());
+    }
+    // the range also grows below, and samples fall on the first bounds
+    samples.push_back(-20.);
+    samples.push_back(0.);
+    samples.push_back(-20.);
+
+    accumulator_t_adaptive acc(density_num_bins = 100);
+    accumulator_t_adaptive block(density_num_bins = 100);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        acc(samples[i]);
+    }
+    block.add_range(samples);
+    BOOST_CHECK(density(acc) == density(block));
+
+    histogram_type hist = density(acc);
+    BOOST_CHECK_EQUAL(102u, hist.size());
+    BOOST_CHECK_EQUAL(0., hist.front().second);
+    BOOST_CHECK_EQUAL(0., hist.back().second);
+    BOOST_CHECK_LE(hist[1].first, -20.);
+    BOOST_CHECK_GT(hist.back().first, samples[9999]);
+
+    std::vector<double> counts = search_bins(hist, samples);
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        BOOST_CHECK_CLOSE(counts[i] / samples.size(), hist[i].second, 1e-10);
+    }
+
+    // the first samples are all the same, then the range grows below
+    accumulator_t_adaptive flat(density_num_bins = 10);
+    std::vector<double> ones(100, 1.);
+    flat.add_range(ones);
+    BOOST_CHECK_EQUAL(1., density(flat)[1].second);
+    flat(0.);
+    BOOST_CHECK_EQUAL(0., density(flat)[1].first);
+    BOOST_CHECK_CLOSE(100. / 101., density(flat)[10].second, 1e-10);
+    BOOST_CHECK_CLOSE(1. / 101., density(flat)[1].second, 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_adaptive_non_finite
+//   infinite samples and NaN are counted in the under- and overflow bins
+//   and leave the bins alone
+//
+void test_adaptive_non_finite()
+{
+    accumulator_t_adaptive acc(density_num_bins = 4);
+    acc(std::numeric_limits<double>::infinity());
+    acc(0.);
+    acc(-std::numeric_limits<double>::infinity());
+    acc(std::numeric_limits<double>::quiet_NaN());
+    acc(3.5);
+
+    histogram_type hist = density(acc);
+    BOOST_CHECK_EQUAL(0., hist[1].first);
+    BOOST_CHECK_EQUAL(4., hist.back().first);
+    BOOST_CHECK_EQUAL(0.2, hist.front().second);
+    BOOST_CHECK_EQUAL(0.4, hist.back().second);
+    BOOST_CHECK_EQUAL(0.2, hist[1].second);
+    BOOST_CHECK_EQUAL(0.2, hist[4].second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_adaptive_extreme
+//   finite samples too far apart for the range of the bins to stay finite are
+//   counted in the under- and overflow bins instead of widening the bins
+//
+void test_adaptive_extreme()
+{
+    double const big = (std::numeric_limits<double>::max)();
+
+    accumulator_t_adaptive acc(density_num_bins = 10);
+    acc(0.);
+    acc(1.);
+    acc(1e308);
+    acc(-1e308);
+    acc(big);
+    acc(-big);
+
+    histogram_type hist = density(acc);
+    double total = 0.;
+    for (std::size_t i = 0; i < hist.size(); ++i)
+    {
+        BOOST_CHECK(hist[i].first - hist[i].first == 0.);
+        total += hist[i].second;
+    }
+    BOOST_CHECK_CLOSE(1., total, 1e-10);
+    BOOST_CHECK_EQUAL(0., hist[1].first);
+    BOOST_CHECK_EQUAL(2. / 6., hist[1].second);
+    BOOST_CHECK_EQUAL(2. / 6., hist.front().second);
+
+    // the range of the first two samples already overflows, and the bins have
+    // no size yet to place the next ones
+    accumulator_t_adaptive wide(density_num_bins = 10);
+    wide(-big);
+    wide(big);
+    wide(0.);
+
+    hist = density(wide);
+    BOOST_CHECK_EQUAL(-big, hist[1].first);
+    BOOST_CHECK_EQUAL(1. / 3., hist[1].second);
+    BOOST_CHECK_EQUAL(2. / 3., hist.back().second);
+
+    // the first two samples are too close for the bins to have a size
+    double const tiny = (std::numeric_limits<double>::denorm_min)();
+    accumulator_t_adaptive narrow(density_num_bins = 10);
+    narrow(0.);
+    narrow(tiny);
+    narrow(-tiny);
+    narrow(0.);
+
+    hist = density(narrow);
+    BOOST_CHECK_EQUAL(0., hist[1].first);
+    BOOST_CHECK_EQUAL(2. / 4., hist[1].second);
+    BOOST_CHECK_EQUAL(1. / 4., hist.front().second);
+    BOOST_CHECK_EQUAL(1. / 4., hist.back().second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_adaptive_median
+//   the adaptive histogram feeds median(with_density)
+//
+void test_adaptive_median()
+{
+    typedef accumulator_set<double, stats<tag::adaptive_density, tag::median(with_density)> > median_t;
+    BOOST_MPL_ASSERT((is_same<
+        fusion::result_of::value_at_c<median_t::accumulators_type, 1>::type::feature_tag
+      , tag::adaptive_density
+    >));
+
+    boost::lagged_fibonacci607 rng;
+    median_t acc(density_num_bins = 1000);
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        acc(1. + 2. * rng());
+    }
+    BOOST_CHECK_CLOSE(2., median(acc), 1.);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_adaptive_persistency
+//
+void test_adaptive_persistency()
+{
+    std::vector<double> samples = make_samples(5000);
+
+    // "persistent" storage
+    std::stringstream ss;
+    {
+        accumulator_t_adaptive acc(density_num_bins = 100);
+        acc.add_range(samples.begin(), samples.begin() + 2000);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t_adaptive acc(density_num_bins = 100);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    acc.add_range(samples.begin() + 2000, samples.end());
+
+    accumulator_t_adaptive one_by_one(density_num_bins = 100);
+    one_by_one.add_range(samples);
+    BOOST_CHECK(density(one_by_one) == density(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("density test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_range));
+    test->add(BOOST_TEST_CASE(&test_weighted));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+    test->add(BOOST_TEST_CASE(&test_adaptive));
+    test->add(BOOST_TEST_CASE(&test_adaptive_non_finite));
+    test->add(BOOST_TEST_CASE(&test_adaptive_extreme));
+    test->add(BOOST_TEST_CASE(&test_adaptive_median));
+    test->add(BOOST_TEST_CASE(&test_adaptive_persistency));
+
+    return test;
+}
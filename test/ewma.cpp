@@ -0,0 +1,204 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for ew_count.hpp, ewma.hpp, ew_variance.hpp and ew_covariance.hpp
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/variates/covariate.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/ew_count.hpp>
+#include <boost/accumulators/statistics/ewma.hpp>
+#include <boost/accumulators/statistics/ew_variance.hpp>
+#include <boost/accumulators/statistics/ew_covariance.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    accumulator_set<int, stats<tag::ewma, tag::ew_variance> > acc(tag::ewma::alpha = 0.5);
+
+    acc(2);
+    BOOST_CHECK_CLOSE(1., ew_count(acc), 1e-10);
+    BOOST_CHECK_CLOSE(2., ewma(acc), 1e-10);
+    BOOST_CHECK_SMALL(ew_variance(acc), 1e-10);
+
+    // weights 1/2 and 1
+    acc(5);
+    BOOST_CHECK_CLOSE(1.5, ew_count(acc), 1e-10);
+    BOOST_CHECK_CLOSE(4., ewma(acc), 1e-10);
+    BOOST_CHECK_CLOSE(2., ew_variance(acc), 1e-10);
+
+    // weights 1/4, 1/2 and 1
+    acc(-1);
+    BOOST_CHECK_CLOSE(1.75, ew_count(acc), 1e-10);
+    BOOST_CHECK_CLOSE(8. / 7., ewma(acc), 1e-10);
+    BOOST_CHECK_CLOSE(598.5 / 85.75, ew_variance(acc), 1e-10);
+
+    // a half-life of one sample is alpha = 1/2
+    accumulator_set<int, stats<tag::ewma> > half(tag::ewma::half_life = 1.);
+    half(2);
+    half(5);
+    half(-1);
+    BOOST_CHECK_CLOSE(8. / 7., ewma(half), 1e-10);
+
+    // alpha = 1 keeps the latest sample alone
+    accumulator_set<int, stats<tag::ewma, tag::ew_variance> > last(tag::ewma::alpha = 1.);
+    last(2);
+    last(5);
+    BOOST_CHECK_CLOSE(5., ewma(last), 1e-10);
+    BOOST_CHECK_SMALL(ew_variance(last), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_weights
+//   the statistics are those of the samples weighted by (1-alpha)^age, for
+//   samples far from zero, and for samples at irregular times
+//
+template<typename Accumulator, typename Weights>
+void check_weighted(Accumulator &acc, std::vector<double> const &xs, std::vector<double> const &ys, Weights const &weight)
+{
+    double sum = 0., mean_x = 0., mean_y = 0.;
+    for(std::size_t i = 0; i < xs.size(); ++i)
+    {
+        sum += weight(i);
+        mean_x += weight(i) * xs[i];
+        mean_y += weight(i) * ys[i];
+    }
+    mean_x /= sum;
+    mean_y /= sum;
+    double variance = 0., covariance = 0.;
+    for(std::size_t i = 0; i < xs.size(); ++i)
+    {
+        variance += weight(i) * (xs[i] - mean_x) * (xs[i] - mean_x);
+        covariance += weight(i) * (xs[i] - mean_x) * (ys[i] - mean_y);
+    }
+
+    BOOST_CHECK_CLOSE(sum, ew_count(acc), 1e-8);
+    BOOST_CHECK_CLOSE(mean_x, ewma(acc), 1e-8);
+    BOOST_CHECK_CLOSE(variance / sum, ew_variance(acc), 1e-6);
+    BOOST_CHECK_CLOSE(covariance / sum, ew_covariance(acc), 1e-6);
+}
+
+struct sample_weights
+{
+    sample_weights(double alpha, std::size_t n) : alpha(alpha), n(n) {}
+    double operator()(std::size_t i) const { return std::pow(1. - alpha, static_cast<double>(n - 1 - i)); }
+    double alpha;
+    std::size_t n;
+};
+
+struct time_weights
+{
+    time_weights(double half_life, std::vector<double> const &times) : half_life(half_life), times(times) {}
+    double operator()(std::size_t i) const { return std::pow(0.5, (times.back() - times[i]) / half_life); }
+    double half_life;
+    std::vector<double> const &times;
+};
+
+void test_weights()
+{
+    typedef stats<tag::ewma, tag::ew_variance, tag::ew_covariance<double, tag::covariate1> > features;
+
+    boost::lagged_fibonacci607 rng;
+    accumulator_set<double, features> acc(tag::ewma::alpha = 0.1);
+    accumulator_set<double, stats<tag::timed_ew_count<>, features> > timed(tag::ewma::half_life = 3.);
+    std::vector<double> xs, ys, times;
+    double t = 0.;
+
+    for(int i = 0; i < 300; ++i)
+    {
+        // bursts of samples at the same time and long gaps
+        t += (i % 29 == 0) ? 20. * rng() : (i % 3 == 0) ? 0. : rng();
+        double x = 1e4 + rng();
+        double y = 2. * x + rng();
+        acc(x, covariate1 = y);
+        timed(x, covariate1 = y, timestamp = t);
+        xs.push_back(x);
+        ys.push_back(y);
+        times.push_back(t);
+
+        check_weighted(acc, xs, ys, sample_weights(0.1, xs.size()));
+        check_weighted(timed, xs, ys, time_weights(3., times));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    typedef accumulator_set<double, stats<tag::timed_ew_count<>, tag::ewma, tag::ew_variance> > accumulator_t;
+
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::ewma::half_life = 1.);
+        acc(1., timestamp = 0.);
+        acc(3., timestamp = 1.);
+        BOOST_CHECK_CLOSE(1.5, ew_count(acc), 1e-10);
+        BOOST_CHECK_CLOSE(7. / 3., ewma(acc), 1e-10);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::ewma::half_life = 100.);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_CLOSE(1.5, ew_count(acc), 1e-10);
+    BOOST_CHECK_CLOSE(7. / 3., ewma(acc), 1e-10);
+    BOOST_CHECK_CLOSE(8. / 9., ew_variance(acc), 1e-10);
+
+    // the half-life and the latest timestamp are restored too
+    acc(0., timestamp = 2.);
+    BOOST_CHECK_CLOSE(1.75, ew_count(acc), 1e-10);
+    BOOST_CHECK_CLOSE(1., ewma(acc), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_invalid
+//   a missing or out of range smoothing factor or half-life is rejected
+//
+void test_invalid()
+{
+    typedef accumulator_set<double, stats<tag::ewma> > accumulator_t;
+    typedef accumulator_set<double, stats<tag::timed_ew_count<>, tag::ewma> > timed_accumulator_t;
+
+    BOOST_CHECK_THROW(accumulator_t(), std::invalid_argument);
+    BOOST_CHECK_THROW(accumulator_t(tag::ewma::alpha = 1.5), std::invalid_argument);
+    BOOST_CHECK_THROW(accumulator_t(tag::ewma::alpha = -0.5), std::invalid_argument);
+    BOOST_CHECK_THROW(accumulator_t(tag::ewma::alpha = std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+    BOOST_CHECK_THROW(accumulator_t(tag::ewma::half_life = 0.), std::invalid_argument);
+    BOOST_CHECK_THROW(accumulator_t(tag::ewma::half_life = -3.), std::invalid_argument);
+    BOOST_CHECK_THROW(timed_accumulator_t(), std::invalid_argument);
+    BOOST_CHECK_THROW(timed_accumulator_t(tag::ewma::half_life = -3.), std::invalid_argument);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("exponentially weighted statistics test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_weights));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+    test->add(BOOST_TEST_CASE(&test_invalid));
+
+    return test;
+}
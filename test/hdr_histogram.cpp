@@ -0,0 +1,290 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for hdr_histogram.hpp
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/hdr_histogram.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace boost::accumulators;
+
+typedef accumulator_set<double, stats<tag::hdr_quantile, tag::hdr_cdf> > accumulator_t;
+
+// the whole set takes a range at once, not sample by sample
+BOOST_MPL_ASSERT((accumulators::detail::all_range_aware<accumulator_t::accumulators_mpl_vector>));
+
+double const probabilities[] = {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+
+// the total number of samples in the histogram
+template<typename Range>
+std::size_t total_count(Range const &rng)
+{
+    std::size_t total = 0;
+    for (typename Range::const_iterator it = rng.begin(); it != rng.end(); ++it)
+    {
+        total += it->second;
+    }
+    return total;
+}
+
+// samples spread over six orders of magnitude, like latencies in nanoseconds
+template<typename Rng>
+double latency(Rng &rng)
+{
+    return std::floor(std::exp(2. + 14. * rng()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//   every quantile is within the relative precision of the exact one
+//
+void test_stat()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t acc;
+    std::vector<double> samples;
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = latency(rng);
+        samples.push_back(sample);
+        acc(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        double exact = samples[static_cast<std::size_t>(p * samples.size() + 0.5) - 1];
+        BOOST_CHECK_CLOSE(exact, quantile(acc, quantile_probability = p), 0.1);
+    }
+
+    BOOST_CHECK_EQUAL(100000u, total_count(hdr_histogram(acc)));
+    BOOST_CHECK_EQUAL(samples.front(), quantile(acc, quantile_probability = 0.));
+    BOOST_CHECK_CLOSE(samples.back(), quantile(acc, quantile_probability = 1.), 0.1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_small
+//   values below 2 * 10^d have buckets of their own
+//
+void test_small()
+{
+    accumulator_set<int, stats<tag::hdr_quantile> > acc(tag::hdr_histogram::significant_digits = 2);
+    for (int i=100; i>0; --i)
+    {
+        acc(i);
+    }
+
+    BOOST_CHECK_EQUAL(100u, hdr_histogram(acc).size());
+    BOOST_CHECK_EQUAL(1u, hdr_histogram(acc).begin()->first);
+    BOOST_CHECK_EQUAL(1., quantile(acc, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(25., quantile(acc, quantile_probability = 0.25));
+    BOOST_CHECK_EQUAL(100., quantile(acc, quantile_probability = 1.));
+
+    // 1000 and 1003 share a bucket of width 4 with 2 digits, but not with 3
+    accumulator_set<int, stats<tag::hdr_histogram> > coarse(tag::hdr_histogram::significant_digits = 2);
+    accumulator_set<int, stats<tag::hdr_histogram> > fine;
+    coarse(1000);
+    coarse(1003);
+    fine(1000);
+    fine(1003);
+    BOOST_CHECK_EQUAL(1u, hdr_histogram(coarse).size());
+    BOOST_CHECK_EQUAL(2u, hdr_histogram(fine).size());
+
+    // negative samples count as 0
+    accumulator_set<int, stats<tag::hdr_quantile> > neg;
+    neg(-5);
+    BOOST_CHECK_EQUAL(0., quantile(neg, quantile_probability = 0.5));
+
+    BOOST_CHECK_THROW(accumulator_t(tag::hdr_histogram::significant_digits = 6), std::invalid_argument);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_large
+//   the relative precision holds up to the largest 64-bit values
+//
+void test_large()
+{
+    accumulator_set<double, stats<tag::hdr_quantile> > acc;
+    double const values[] = {1e6, 3.3e9, 7.7e12, 1.2e16, 1.8e19};
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(double); ++i)
+    {
+        acc(values[i]);
+    }
+
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(double); ++i)
+    {
+        double p = (i + 1) / 5.;
+        BOOST_CHECK_CLOSE(values[i], quantile(acc, quantile_probability = p), 0.1);
+    }
+
+    // samples too large for 64 bits count as the largest value
+    accumulator_t huge;
+    huge(1.);
+    huge(std::numeric_limits<double>::infinity());
+    huge(1e30);
+    huge(18446744073709551616.);
+    huge(std::numeric_limits<double>::quiet_NaN());
+    BOOST_CHECK_CLOSE(18446744073709551615., quantile(huge, quantile_probability = 1.), 0.1);
+    BOOST_CHECK_CLOSE(18446744073709551615., quantile(huge, quantile_probability = 0.5), 0.1);
+    BOOST_CHECK_EQUAL(0., quantile(huge, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(1., hdr_cdf(huge, sample = std::numeric_limits<double>::infinity()));
+    BOOST_CHECK_CLOSE(0.4, hdr_cdf(huge, sample = 1.), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_cdf
+//
+void test_cdf()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t acc;
+    std::vector<double> samples;
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = latency(rng);
+        samples.push_back(sample);
+        acc(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        double x = samples[static_cast<std::size_t>(p * samples.size())];
+        double below = double(std::lower_bound(samples.begin(), samples.end(), x * 0.999) - samples.begin()) / samples.size();
+        double above = double(std::upper_bound(samples.begin(), samples.end(), x * 1.001) - samples.begin()) / samples.size();
+        double cdf = hdr_cdf(acc, sample = x);
+        BOOST_CHECK_GE(cdf, below);
+        BOOST_CHECK_LE(cdf, above);
+    }
+
+    BOOST_CHECK_EQUAL(0., hdr_cdf(acc, sample = -1.));
+    BOOST_CHECK_EQUAL(1., hdr_cdf(acc, sample = samples.back()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_merge
+//   merging is exact, also when the precisions differ
+//
+void test_merge()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t whole;
+    accumulator_t parts[4];
+    accumulator_t coarse(tag::hdr_histogram::significant_digits = 2);
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = latency(rng);
+        whole(sample);
+        parts[i % 4](sample);
+    }
+
+    accumulator_t merged;
+    for (int i=0; i<4; ++i)
+    {
+        merged.merge(parts[i]);
+        coarse.merge(parts[i]);
+    }
+
+    BOOST_CHECK_EQUAL(100000u, total_count(hdr_histogram(merged)));
+    BOOST_CHECK_EQUAL(100000u, total_count(hdr_histogram(coarse)));
+    BOOST_CHECK(hdr_histogram(whole) == hdr_histogram(merged));
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_EQUAL(quantile(whole, quantile_probability = p), quantile(merged, quantile_probability = p));
+        BOOST_CHECK_CLOSE(quantile(whole, quantile_probability = p), quantile(coarse, quantile_probability = p), 1.);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_range
+//   adding a range counts the same as adding the samples one by one
+//
+void test_range()
+{
+    boost::lagged_fibonacci607 rng;
+
+    std::vector<double> samples;
+    accumulator_t one_by_one;
+    for (int i=0; i<10000; ++i)
+    {
+        double sample = latency(rng);
+        samples.push_back(sample);
+        one_by_one(sample);
+    }
+
+    accumulator_t acc;
+    acc.add_range(samples.begin(), samples.end());
+    BOOST_CHECK(hdr_histogram(one_by_one) == hdr_histogram(acc));
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_EQUAL(quantile(one_by_one, quantile_probability = p), quantile(acc, quantile_probability = p));
+        BOOST_CHECK_EQUAL(hdr_cdf(one_by_one, sample = p), hdr_cdf(acc, sample = p));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    // "persistent" storage
+    std::stringstream ss;
+    // a random number generator
+    boost::lagged_fibonacci607 rng;
+    double q99 = 0.;
+    {
+        accumulator_t acc(tag::hdr_histogram::significant_digits = 2);
+        for (int i=0; i<100000; ++i)
+        {
+            acc(latency(rng));
+        }
+        q99 = quantile(acc, quantile_probability = 0.99);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc;
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(q99, quantile(acc, quantile_probability = 0.99));
+    BOOST_CHECK_EQUAL(100000u, total_count(hdr_histogram(acc)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("hdr_histogram test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_small));
+    test->add(BOOST_TEST_CASE(&test_large));
+    test->add(BOOST_TEST_CASE(&test_cdf));
+    test->add(BOOST_TEST_CASE(&test_merge));
+    test->add(BOOST_TEST_CASE(&test_range));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
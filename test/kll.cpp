@@ -0,0 +1,202 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for kll.hpp
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/kll.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace boost::accumulators;
+
+typedef accumulator_set<double, stats<tag::kll_quantile> > accumulator_t;
+typedef accumulator_set<double, stats<tag::kll_quantile(relative_error)> > accumulator_t_relative;
+
+double const probabilities[] = {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+
+// the fraction of the sorted samples that are less than x
+double rank(std::vector<double> const &sorted, double x)
+{
+    return double(std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / sorted.size();
+}
+
+// the total number of samples the retained ones stand for
+template<typename Range>
+std::size_t total_weight(Range const &rng)
+{
+    std::size_t total = 0;
+    for (typename Range::const_iterator it = rng.begin(); it != rng.end(); ++it)
+    {
+        total += it->second;
+    }
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t acc;
+    std::vector<double> samples;
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        acc(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(rank(samples, quantile(acc, quantile_probability = p)) - p, 0.01);
+    }
+
+    // memory is O(k log(N / k)), and no sample is lost
+    BOOST_CHECK_LE(kll(acc).size(), 1000u);
+    BOOST_CHECK_EQUAL(100000u, total_weight(kll(acc)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_small
+//   as long as nothing has been compacted, the quantiles are exact
+//
+void test_small()
+{
+    accumulator_set<int, stats<tag::kll_quantile> > acc;
+    for (int i=100; i>0; --i)
+    {
+        acc(i);
+    }
+
+    BOOST_CHECK_EQUAL(100u, kll(acc).size());
+    BOOST_CHECK_EQUAL(1, quantile(acc, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(26, quantile(acc, quantile_probability = 0.25));
+    BOOST_CHECK_EQUAL(100, quantile(acc, quantile_probability = 1.));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_relative
+//   the error of the rank is relative to the number of samples above it
+//
+void test_relative()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t_relative acc;
+    std::vector<double> samples;
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        acc(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BOOST_CHECK_EQUAL(100000u, total_weight(relative_kll(acc)));
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(rank(samples, quantile(acc, quantile_probability = p)) - p, 0.05 * (1 - p));
+    }
+
+    // the largest samples are always retained
+    BOOST_CHECK_EQUAL(samples.back(), quantile(acc, quantile_probability = 1.));
+    BOOST_CHECK_EQUAL(samples[samples.size() - 10], quantile(acc, quantile_probability = 0.9999));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_merge
+//
+void test_merge()
+{
+    boost::lagged_fibonacci607 rng;
+
+    std::vector<double> samples;
+    accumulator_t parts[4];
+    accumulator_t_relative relative_parts[4];
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        parts[i % 4](sample);
+        relative_parts[i % 4](sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    accumulator_t merged;
+    accumulator_t_relative relative_merged;
+    for (int i=0; i<4; ++i)
+    {
+        merged.merge(parts[i]);
+        relative_merged.merge(relative_parts[i]);
+    }
+
+    BOOST_CHECK_EQUAL(100000u, total_weight(kll(merged)));
+    BOOST_CHECK_EQUAL(100000u, total_weight(relative_kll(relative_merged)));
+    BOOST_CHECK_LE(kll(merged).size(), 1000u);
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(rank(samples, quantile(merged, quantile_probability = p)) - p, 0.01);
+        BOOST_CHECK_SMALL(rank(samples, quantile(relative_merged, quantile_probability = p)) - p, 0.05 * (1 - p));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    // "persistent" storage
+    std::stringstream ss;
+    // a random number generator
+    boost::lagged_fibonacci607 rng;
+    double q99 = 0.;
+    {
+        accumulator_t acc;
+        for (int i=0; i<100000; ++i)
+        {
+            acc(rng());
+        }
+        q99 = quantile(acc, quantile_probability = 0.99);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc;
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(q99, quantile(acc, quantile_probability = 0.99));
+    BOOST_CHECK_EQUAL(100000u, total_weight(kll(acc)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("kll test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_small));
+    test->add(BOOST_TEST_CASE(&test_relative));
+    test->add(BOOST_TEST_CASE(&test_merge));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
@@ -0,0 +1,367 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/numeric/functional/vector.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/sum_kahan.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/moment.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/covariance.hpp>
+#include <boost/accumulators/statistics/variates/covariate.hpp>
+#include <boost/accumulators/statistics/weighted_sum.hpp>
+#include <boost/accumulators/statistics/weighted_sum_kahan.hpp>
+#include <boost/accumulators/statistics/weighted_mean.hpp>
+#include <boost/accumulators/statistics/weighted_moment.hpp>
+#include <boost/accumulators/statistics/weighted_variance.hpp>
+#include <boost/accumulators/statistics/weighted_covariance.hpp>
+#include <boost/accumulators/statistics/tail.hpp>
+#include <boost/accumulators/statistics/tail_variate.hpp>
+#include <boost/accumulators/statistics/tail_quantile.hpp>
+#include <boost/accumulators/statistics/tail_mean.hpp>
+#include <boost/accumulators/statistics/tail_variate_means.hpp>
+#include <boost/accumulators/statistics/weighted_tail_quantile.hpp>
+#include <boost/accumulators/statistics/weighted_tail_mean.hpp>
+#include <boost/accumulators/statistics/weighted_tail_variate_means.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+///////////////////////////////////////////////////////////////////////////////
+// make_data
+//
+std::vector<double> make_data(std::size_t size, double offset)
+{
+    std::vector<double> data;
+    unsigned int seed = 7;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data.push_back(offset + static_cast<double>((seed >> 8) % 10007) / 1000.);
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//   three shards, one of them empty, merged into the first
+//
+template<typename Features>
+void test_stat_for(std::size_t split, void (*check)(accumulator_set<double, Features> const &, accumulator_set<double, Features> const &))
+{
+    typedef accumulator_set<double, Features> acc_type;
+    std::vector<double> data = make_data(1000, 1e6);
+
+    acc_type all, shard1, shard2, empty;
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        all(data[i]);
+        (i < split ? shard1 : shard2)(data[i]);
+    }
+
+    shard1.merge(empty);
+    shard1.merge(shard2);
+    check(all, shard1);
+
+    // merging into an empty set yields the other set
+    empty.merge(all);
+    check(all, empty);
+}
+
+typedef stats<tag::count, tag::sum, tag::min, tag::max, tag::mean, tag::moment<2>, tag::lazy_variance> lazy_stats;
+typedef stats<tag::mean(immediate), tag::variance> immediate_stats;
+
+void check_lazy(accumulator_set<double, lazy_stats> const &all, accumulator_set<double, lazy_stats> const &merged)
+{
+    BOOST_CHECK_EQUAL(count(all), count(merged));
+    BOOST_CHECK_CLOSE(sum(all), sum(merged), 1e-10);
+    BOOST_CHECK_EQUAL((min)(all), (min)(merged));
+    BOOST_CHECK_EQUAL((max)(all), (max)(merged));
+    BOOST_CHECK_CLOSE(mean(all), mean(merged), 1e-10);
+    BOOST_CHECK_CLOSE(accumulators::moment<2>(all), accumulators::moment<2>(merged), 1e-10);
+}
+
+void check_immediate(accumulator_set<double, immediate_stats> const &all, accumulator_set<double, immediate_stats> const &merged)
+{
+    BOOST_CHECK_EQUAL(count(all), count(merged));
+    BOOST_CHECK_CLOSE(mean(all), mean(merged), 1e-10);
+    // the data sits far from the origin; the pairwise update keeps the
+    // variance accurate where moment<2> - mean^2 would not be
+    BOOST_CHECK_CLOSE(variance(all), variance(merged), 1e-8);
+}
+
+void test_stat()
+{
+    test_stat_for<lazy_stats>(300, &check_lazy);
+    test_stat_for<immediate_stats>(300, &check_immediate);
+    test_stat_for<immediate_stats>(1, &check_immediate);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_covariance
+//
+void test_covariance()
+{
+    typedef accumulator_set<double, stats<tag::covariance<double, tag::covariate1> > > acc_type;
+    std::vector<double> data = make_data(500, 10.);
+
+    acc_type all, shard1, shard2;
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        double variate = 2. * data[i] + data[(i * 7) % data.size()];
+        all(data[i], covariate1 = variate);
+        (i % 3 ? shard1 : shard2)(data[i], covariate1 = variate);
+    }
+
+    shard1.merge(shard2);
+    BOOST_CHECK_CLOSE(covariance(all), covariance(shard1), 1e-8);
+    BOOST_CHECK_CLOSE(mean(all), mean(shard1), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_weighted
+//
+void test_weighted()
+{
+    typedef accumulator_set<
+        double
+      , stats<
+            tag::weighted_sum
+          , tag::weighted_mean
+          , tag::weighted_moment<2>
+          , tag::weighted_variance
+          , tag::weighted_covariance<double, tag::covariate1>
+        >
+      , double
+    > acc_type;
+
+    typedef accumulator_set<double, stats<tag::weighted_mean(immediate)>, double> immediate_acc_type;
+
+    std::vector<double> data = make_data(600, 5.);
+
+    acc_type all, shard1, shard2;
+    immediate_acc_type iall, ishard1, ishard2;
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        double w = 0.5 + (i % 5);
+        double variate = data[i] - data[(i * 11) % data.size()];
+        all(data[i], weight = w, covariate1 = variate);
+        iall(data[i], weight = w);
+        if(i < 200)
+        {
+            shard1(data[i], weight = w, covariate1 = variate);
+            ishard1(data[i], weight = w);
+        }
+        else
+        {
+            shard2(data[i], weight = w, covariate1 = variate);
+            ishard2(data[i], weight = w);
+        }
+    }
+
+    shard1.merge(shard2);
+    ishard1.merge(ishard2);
+
+    BOOST_CHECK_EQUAL(count(all), count(shard1));
+    BOOST_CHECK_CLOSE(sum_of_weights(all), sum_of_weights(shard1), 1e-10);
+    BOOST_CHECK_CLOSE(weighted_sum(all), weighted_sum(shard1), 1e-10);
+    BOOST_CHECK_CLOSE(weighted_mean(all), weighted_mean(shard1), 1e-10);
+    BOOST_CHECK_CLOSE(accumulators::weighted_moment<2>(all), accumulators::weighted_moment<2>(shard1), 1e-10);
+    BOOST_CHECK_CLOSE(weighted_variance(all), weighted_variance(shard1), 1e-8);
+    BOOST_CHECK_CLOSE(weighted_covariance(all), weighted_covariance(shard1), 1e-8);
+    BOOST_CHECK_CLOSE(weighted_mean(iall), weighted_mean(ishard1), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_kahan
+//   the compensation terms of both sets carry over
+//
+void test_kahan()
+{
+    accumulator_set<float, stats<tag::sum_kahan> > acc, acc2;
+    accumulator_set<float, stats<tag::weighted_sum_kahan>, float> wacc, wacc2;
+    for(int i = 0; i < 1000000; ++i)
+    {
+        acc(1e-6f);
+        acc2(1e-6f);
+        wacc(1e-6f, weight = 2.f);
+        wacc2(1e-6f, weight = 2.f);
+    }
+
+    acc.merge(acc2);
+    wacc.merge(wacc2);
+    BOOST_CHECK_CLOSE(2.f, sum_kahan(acc), 1e-5);
+    BOOST_CHECK_CLOSE(4.f, weighted_sum_kahan(wacc), 1e-5);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_tail
+//   shards smaller and larger than the cache, and an empty one, merged into
+//   the smallest, give the tail, its variates and weights, and the tail
+//   statistics, weighted or not, of one set
+//
+template<typename Tail, typename LeftRight>
+void test_tail()
+{
+    typedef std::vector<double> variate_type;
+    typedef accumulator_set<
+        double
+      , stats<
+            Tail
+          , tag::tail_quantile<LeftRight>
+          , tag::coherent_tail_mean<LeftRight>
+          , tag::tail_variate_means<LeftRight, variate_type, tag::covariate1>(relative)
+        >
+    > acc_type;
+    typedef accumulator_set<
+        double
+      , stats<
+            Tail
+          , tag::weighted_tail_quantile<LeftRight>
+          , tag::weighted_tail_variate_means<LeftRight, variate_type, tag::covariate1>(relative)
+        >
+      , double
+    > weighted_acc_type;
+
+    std::vector<double> data = make_data(1000, 0.);
+    acc_type all(tag::tail<LeftRight>::cache_size = 20);
+    acc_type shard1(tag::tail<LeftRight>::cache_size = 20);
+    acc_type shard2(tag::tail<LeftRight>::cache_size = 20);
+    acc_type shard3(tag::tail<LeftRight>::cache_size = 20);
+    acc_type empty(tag::tail<LeftRight>::cache_size = 20);
+    weighted_acc_type weighted_all(tag::tail<LeftRight>::cache_size = 20);
+    weighted_acc_type weighted_shard1(tag::tail<LeftRight>::cache_size = 20);
+    weighted_acc_type weighted_shard2(tag::tail<LeftRight>::cache_size = 20);
+
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        // distinct samples, so that the tail is not ambiguous
+        double x = data[i] + i * 1e-7;
+        variate_type variate(2, x);
+        variate[1] = static_cast<double>(i);
+        all(x, covariate1 = variate);
+        (i < 5 ? shard1 : i < 300 ? shard2 : shard3)(x, covariate1 = variate);
+        double w = 1. + i % 3;
+        weighted_all(x, weight = w, covariate1 = variate);
+        (i % 2 ? weighted_shard1 : weighted_shard2)(x, weight = w, covariate1 = variate);
+    }
+
+    // a query sorts the tail, or selects from it, before the merge
+    tail_quantile(shard2, quantile_probability = 0.99);
+    shard1.merge(empty);
+    shard1.merge(shard2);
+    shard1.merge(shard3);
+    weighted_shard1.merge(weighted_shard2);
+
+    std::vector<double> expected(tail(all).begin(), tail(all).end());
+    std::vector<double> actual(tail(shard1).begin(), tail(shard1).end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+    std::vector<double> expected_weights(tail_weights(weighted_all).begin(), tail_weights(weighted_all).end());
+    std::vector<double> actual_weights(tail_weights(weighted_shard1).begin(), tail_weights(weighted_shard1).end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected_weights.begin(), expected_weights.end(), actual_weights.begin(), actual_weights.end());
+    for(std::size_t i = 0; i < expected.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL((tail_variate(all).begin() + i)->at(1), (tail_variate(shard1).begin() + i)->at(1));
+    }
+
+    BOOST_CHECK_EQUAL(count(all), count(shard1));
+    double const probabilities[] = {0.99, 0.995, 0.999};
+    for(int j = 0; j < 3; ++j)
+    {
+        double p = is_same<LeftRight, right>::value ? probabilities[j] : 1. - probabilities[j];
+        BOOST_CHECK_EQUAL(tail_quantile(all, quantile_probability = p), tail_quantile(shard1, quantile_probability = p));
+        BOOST_CHECK_CLOSE(tail_mean(all, quantile_probability = p), tail_mean(shard1, quantile_probability = p), 1e-10);
+        BOOST_CHECK_CLOSE(
+            *relative_tail_variate_means(all, quantile_probability = p).begin()
+          , *relative_tail_variate_means(shard1, quantile_probability = p).begin()
+          , 1e-10
+        );
+        BOOST_CHECK_EQUAL(
+            weighted_tail_quantile(weighted_all, quantile_probability = p)
+          , weighted_tail_quantile(weighted_shard1, quantile_probability = p)
+        );
+        BOOST_CHECK_CLOSE(
+            *relative_weighted_tail_variate_means(weighted_all, quantile_probability = p).begin()
+          , *relative_weighted_tail_variate_means(weighted_shard1, quantile_probability = p).begin()
+          , 1e-10
+        );
+    }
+
+    // the merged tail keeps taking samples
+    all(20., covariate1 = variate_type(2, 20.));
+    shard1(20., covariate1 = variate_type(2, 20.));
+    all(-20., covariate1 = variate_type(2, -20.));
+    shard1(-20., covariate1 = variate_type(2, -20.));
+    expected.assign(tail(all).begin(), tail(all).end());
+    actual.assign(tail(shard1).begin(), tail(shard1).end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+    BOOST_CHECK_EQUAL(tail_variate(all).begin()->at(0), tail_variate(shard1).begin()->at(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_self_merge
+//
+void test_self_merge()
+{
+    accumulator_set<int, stats<tag::count, tag::sum, tag::variance> > acc;
+    acc(1);
+    acc(2);
+    acc(6);
+
+    acc.merge(acc);
+    BOOST_CHECK_EQUAL(6u, count(acc));
+    BOOST_CHECK_EQUAL(18, sum(acc));
+    // the population variance of {1,2,6} twice over is that of {1,2,6}
+    BOOST_CHECK_CLOSE(14./3., variance(acc), 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_droppable
+//
+void test_droppable()
+{
+    accumulator_set<int, stats<droppable<tag::sum>, tag::count> > acc, acc2;
+    acc(1);
+    acc2(2);
+
+    acc.merge(acc2);
+    BOOST_CHECK_EQUAL(3, sum(acc));
+
+    // a dropped accumulator keeps its result
+    acc.drop<tag::sum>();
+    acc.merge(acc2);
+    BOOST_CHECK_EQUAL(3, sum(acc));
+    BOOST_CHECK_EQUAL(3u, count(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("merge test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_covariance));
+    test->add(BOOST_TEST_CASE(&test_weighted));
+    test->add(BOOST_TEST_CASE(&test_kahan));
+    test->add(BOOST_TEST_CASE((&test_tail<tag::tail<right>, right>)));
+    test->add(BOOST_TEST_CASE((&test_tail<tag::tail<left>, left>)));
+    test->add(BOOST_TEST_CASE((&test_tail<tag::buffered_tail<right>, right>)));
+    test->add(BOOST_TEST_CASE((&test_tail<tag::buffered_tail<left>, left>)));
+    test->add(BOOST_TEST_CASE(&test_self_merge));
+    test->add(BOOST_TEST_CASE(&test_droppable));
+
+    return test;
+}
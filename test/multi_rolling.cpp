@@ -0,0 +1,208 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for multi_rolling.hpp
+
+#include <deque>
+#include <vector>
+#include <numeric>
+#include <valarray>
+#include <stdexcept>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/numeric/functional/valarray.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/multi_rolling.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    std::vector<std::size_t> horizons;
+    horizons.push_back(2);
+    horizons.push_back(4);
+
+    accumulator_set<int, stats<tag::multi_rolling_sum, tag::multi_rolling_mean, tag::multi_rolling_variance> > acc(
+        tag::rolling_window::window_size = 4
+      , tag::multi_rolling_mean::horizons = horizons
+    );
+
+    acc(1);
+    BOOST_CHECK_EQUAL(1u, multi_rolling_count(acc)[0]);
+    BOOST_CHECK_EQUAL(1, multi_rolling_sum(acc)[1]);
+    BOOST_CHECK_EQUAL(0., multi_rolling_variance(acc)[0]);
+
+    acc(3);
+    acc(5); // 1 leaves the window of 2
+    BOOST_CHECK_EQUAL(2u, multi_rolling_count(acc)[0]);
+    BOOST_CHECK_EQUAL(3u, multi_rolling_count(acc)[1]);
+    BOOST_CHECK_EQUAL(8, multi_rolling_sum(acc)[0]);
+    BOOST_CHECK_EQUAL(9, multi_rolling_sum(acc)[1]);
+    BOOST_CHECK_CLOSE(4., multi_rolling_mean(acc)[0], 1e-10);
+    BOOST_CHECK_CLOSE(3., multi_rolling_mean(acc)[1], 1e-10);
+    BOOST_CHECK_CLOSE(2., multi_rolling_variance(acc)[0], 1e-10);
+    BOOST_CHECK_CLOSE(4., multi_rolling_variance(acc)[1], 1e-10);
+
+    acc(7);
+    acc(9); // 1 leaves the window of 4
+    BOOST_CHECK_EQUAL(16, multi_rolling_sum(acc)[0]);
+    BOOST_CHECK_EQUAL(24, multi_rolling_sum(acc)[1]);
+    BOOST_CHECK_CLOSE(6., multi_rolling_mean(acc)[1], 1e-10);
+    BOOST_CHECK_CLOSE(20. / 3., multi_rolling_variance(acc)[1], 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_scan
+//   the statistics of each horizon are those of the last samples of that
+//   horizon, computed directly, for samples far from zero
+//
+void test_scan()
+{
+    std::size_t const sizes[] = {1, 2, 10, 37, 100};
+    std::vector<std::size_t> horizons(sizes, sizes + sizeof(sizes) / sizeof(sizes[0]));
+
+    accumulator_set<double, stats<tag::multi_rolling_sum, tag::multi_rolling_mean, tag::multi_rolling_variance> > acc(
+        tag::rolling_window::window_size = 100
+      , tag::multi_rolling_mean::horizons = horizons
+    );
+
+    boost::lagged_fibonacci607 rng;
+    std::deque<double> samples;
+    for(int i = 0; i < 1000; ++i)
+    {
+        double x = 1000. + 10. * rng();
+        acc(x);
+        samples.push_back(x);
+
+        for(std::size_t j = 0; j < horizons.size(); ++j)
+        {
+            std::size_t const n = samples.size() < horizons[j] ? samples.size() : horizons[j];
+            double const sum = std::accumulate(samples.end() - n, samples.end(), 0.);
+            double const mean = sum / n;
+            double sum_of_squares = 0.;
+            for(std::deque<double>::const_iterator it = samples.end() - n; it != samples.end(); ++it)
+            {
+                sum_of_squares += (*it - mean) * (*it - mean);
+            }
+
+            BOOST_CHECK_EQUAL(n, multi_rolling_count(acc)[j]);
+            BOOST_CHECK_CLOSE(sum, multi_rolling_sum(acc)[j], 1e-8);
+            BOOST_CHECK_CLOSE(mean, multi_rolling_mean(acc)[j], 1e-8);
+            if(n > 1)
+            {
+                BOOST_CHECK_SMALL(sum_of_squares / (n - 1) - multi_rolling_variance(acc)[j], 1e-8);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    typedef accumulator_set<int, stats<tag::multi_rolling_mean, tag::multi_rolling_variance> > accumulator_t;
+    std::vector<std::size_t> horizons(1, 2);
+    horizons.push_back(3);
+
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::rolling_window::window_size = 3, tag::multi_rolling_mean::horizons = horizons);
+        acc(1);
+        acc(3);
+        acc(5);
+        BOOST_CHECK_CLOSE(4., multi_rolling_mean(acc)[0], 1e-10);
+        BOOST_CHECK_CLOSE(3., multi_rolling_mean(acc)[1], 1e-10);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::rolling_window::window_size = 3, tag::multi_rolling_mean::horizons = std::vector<std::size_t>(2, 1));
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_CLOSE(4., multi_rolling_mean(acc)[0], 1e-10);
+    BOOST_CHECK_CLOSE(4., multi_rolling_variance(acc)[1], 1e-10);
+
+    // the horizons are restored too
+    acc(7); // 3 leaves the window of 2 and 1 the window of 3
+    BOOST_CHECK_CLOSE(6., multi_rolling_mean(acc)[0], 1e-10);
+    BOOST_CHECK_CLOSE(5., multi_rolling_mean(acc)[1], 1e-10);
+    BOOST_CHECK_EQUAL(3u, multi_rolling_count(acc)[1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_invalid
+//   a horizon of 0, or larger than the buffer, is rejected
+//
+void test_invalid()
+{
+    typedef accumulator_set<int, stats<tag::multi_rolling_mean> > accumulator_t;
+    std::vector<std::size_t> horizons(1, 2);
+    horizons.push_back(5);
+
+    BOOST_CHECK_THROW(accumulator_t(tag::rolling_window::window_size = 4, tag::multi_rolling_mean::horizons = horizons), std::invalid_argument);
+    horizons[1] = 0;
+    BOOST_CHECK_THROW(accumulator_t(tag::rolling_window::window_size = 4, tag::multi_rolling_mean::horizons = horizons), std::invalid_argument);
+    horizons[1] = 4;
+    accumulator_t acc(tag::rolling_window::window_size = 4, tag::multi_rolling_mean::horizons = horizons);
+    BOOST_CHECK_EQUAL(2u, multi_rolling_count(acc).size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_valarray
+//   the variances of valarray samples, element by element
+//
+void test_valarray()
+{
+    typedef std::valarray<double> sample_t;
+    std::vector<std::size_t> horizons;
+    horizons.push_back(2);
+    horizons.push_back(4);
+
+    accumulator_set<sample_t, stats<tag::multi_rolling_variance> > acc(
+        tag::rolling_window::window_size = 4
+      , tag::multi_rolling_mean::horizons = horizons
+      , sample = sample_t(0., 2)
+    );
+
+    for(int i = 0; i < 10; ++i)
+    {
+        sample_t x(2);
+        x[0] = i;
+        x[1] = -2. * i;
+        acc(x);
+    }
+
+    // the last samples are 8, 9 and 6, 7, 8, 9, and twice as far apart in the second element
+    BOOST_CHECK_CLOSE(0.5, multi_rolling_variance(acc)[0][0], 1e-10);
+    BOOST_CHECK_CLOSE(2., multi_rolling_variance(acc)[0][1], 1e-10);
+    BOOST_CHECK_CLOSE(5. / 3., multi_rolling_variance(acc)[1][0], 1e-10);
+    BOOST_CHECK_CLOSE(20. / 3., multi_rolling_variance(acc)[1][1], 1e-10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("multi rolling test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_scan));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+    test->add(BOOST_TEST_CASE(&test_invalid));
+    test->add(BOOST_TEST_CASE(&test_valarray));
+
+    return test;
+}
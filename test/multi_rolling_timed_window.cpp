@@ -0,0 +1,30 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The multi-horizon statistics count samples, so they must not compile with a
+// timed_rolling_window in place of the window of N samples.
+
+#include <vector>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/timed_rolling_window.hpp>
+#include <boost/accumulators/statistics/multi_rolling.hpp>
+
+using namespace boost::accumulators;
+
+int main()
+{
+    std::vector<std::size_t> horizons;
+    horizons.push_back(2);
+    horizons.push_back(4);
+
+    accumulator_set<double, stats<tag::timed_rolling_window<>, tag::multi_rolling_sum> > acc(
+        tag::rolling_window::window_size = 4
+      , tag::rolling_window_duration::window_duration = 100.
+      , tag::multi_rolling_sum::horizons = horizons
+    );
+    acc(1., timestamp = 0.);
+    return 0;
+}
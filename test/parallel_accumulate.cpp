@@ -0,0 +1,168 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/framework/parallel_accumulate.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/count.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+typedef accumulator_set<double, stats<tag::mean, tag::variance, tag::min, tag::max> > acc_type;
+
+std::vector<double> make_data(std::size_t size)
+{
+    std::vector<double> data;
+    unsigned int seed = 3;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data.push_back(static_cast<double>((seed >> 8) % 100003) / 100. - 300.);
+    }
+    return data;
+}
+
+template<typename Executor>
+void check_executor(Executor const &exec, std::vector<double> const &data, std::size_t chunk_size)
+{
+    acc_type expected;
+    expected.add_range(data);
+
+    acc_type acc = parallel_accumulate(data.begin(), data.end(), acc_type(), exec, chunk_size);
+
+    BOOST_CHECK_EQUAL(count(expected), count(acc));
+    BOOST_CHECK_EQUAL((min)(expected), (min)(acc));
+    BOOST_CHECK_EQUAL((max)(expected), (max)(acc));
+    BOOST_CHECK_CLOSE(mean(expected), mean(acc), 1e-9);
+    BOOST_CHECK_CLOSE(variance(expected), variance(acc), 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_sequential
+//
+void test_sequential()
+{
+    std::vector<double> data = make_data(10007);
+    check_executor(sequential_executor(), data, 100);
+    check_executor(sequential_executor(), data, 0);
+
+    // an empty range leaves the prototype as it was
+    acc_type acc = parallel_accumulate<acc_type>(data.end(), data.end());
+    BOOST_CHECK_EQUAL(0u, count(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_threads
+//   more workers than hardware threads and chunks that do not divide the
+//   range evenly
+//
+void test_threads()
+{
+#ifdef BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+    std::vector<double> data = make_data(100003);
+    check_executor(thread_executor(4), data, 997);
+    check_executor(thread_executor(7), data, 1);
+    check_executor(thread_executor(16), data, 50000);
+    check_executor(thread_executor(), data, 0);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_reuse
+//   the calls of one executor run on the same threads
+//
+#ifdef BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+struct thread_id_task
+{
+    explicit thread_id_task(std::vector<std::thread::id> &ids)
+      : ids(&ids)
+    {
+    }
+
+    void operator ()(std::size_t worker, std::size_t) const
+    {
+        (*this->ids)[worker] = std::this_thread::get_id();
+    }
+
+    std::vector<std::thread::id> *ids;
+};
+#endif
+
+void test_reuse()
+{
+#ifdef BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+    thread_executor exec(4);
+    std::vector<std::thread::id> first(4), second(4);
+    thread_id_task first_task(first), second_task(second);
+    exec(first_task, 1000);
+    exec(second_task, 1000);
+    for(std::size_t i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(std::thread::id() == first[i] || std::thread::id() == second[i] || first[i] == second[i]);
+    }
+    BOOST_CHECK(std::this_thread::get_id() == first[0]);
+
+    // a copy shares the threads, and a call with fewer jobs than workers uses fewer of them
+    thread_executor copy(exec);
+    std::vector<double> data = make_data(100003);
+    for(int i = 0; i < 10; ++i)
+    {
+        check_executor(copy, data, 997);
+        check_executor(exec, data, 50000);
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_exception
+//   an exception thrown by a job reaches the caller
+//
+struct throwing_task
+{
+    void operator ()(std::size_t, std::size_t job) const
+    {
+        if(job == 13)
+        {
+            throw std::runtime_error("job 13");
+        }
+    }
+};
+
+void test_exception()
+{
+#ifdef BOOST_ACCUMULATORS_HAS_THREAD_EXECUTOR
+    throwing_task task;
+    thread_executor exec(3);
+    BOOST_CHECK_THROW(exec(task, 100), std::runtime_error);
+
+    // the threads survive the exception
+    check_executor(exec, make_data(10007), 100);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("parallel_accumulate test");
+
+    test->add(BOOST_TEST_CASE(&test_sequential));
+    test->add(BOOST_TEST_CASE(&test_threads));
+    test->add(BOOST_TEST_CASE(&test_reuse));
+    test->add(BOOST_TEST_CASE(&test_exception));
+
+    return test;
+}
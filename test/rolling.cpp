@@ -0,0 +1,224 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for rolling.hpp
+
+#include <cmath>
+#include <deque>
+#include <algorithm>
+#include <functional>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/min.hpp>
+#include <boost/accumulators/statistics/max.hpp>
+#include <boost/accumulators/statistics/sum.hpp>
+#include <boost/accumulators/statistics/hdr_histogram.hpp>
+#include <boost/accumulators/statistics/tail_quantile.hpp>
+#include <boost/accumulators/statistics/timed_rolling_window.hpp>
+#include <boost/accumulators/statistics/rolling.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    accumulator_set<int, stats<tag::rolling<tag::min>, tag::rolling<tag::max>, tag::rolling<tag::sum> > >
+        acc(tag::rolling_window::window_size = 3);
+
+    acc(5);
+    BOOST_CHECK_EQUAL(5, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(5, rolling<tag::max>(acc));
+
+    acc(1);
+    acc(4);
+    BOOST_CHECK_EQUAL(1, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(5, rolling<tag::max>(acc));
+    BOOST_CHECK_EQUAL(10, rolling<tag::sum>(acc));
+
+    acc(7); // 5 leaves
+    BOOST_CHECK_EQUAL(1, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(7, rolling<tag::max>(acc));
+    BOOST_CHECK_EQUAL(12, rolling<tag::sum>(acc));
+
+    acc(3); // 1 leaves
+    BOOST_CHECK_EQUAL(3, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(7, rolling<tag::max>(acc));
+
+    acc(2); // 4 leaves
+    acc(2); // 7 leaves
+    BOOST_CHECK_EQUAL(2, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(3, rolling<tag::max>(acc));
+    BOOST_CHECK_EQUAL(7, rolling<tag::sum>(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_scan
+//   the results are those of the feature over a copy of the window, for several
+//   window sizes, and the extraction parameters are given to the feature
+//
+void test_scan()
+{
+    typedef accumulator_set<int, stats<tag::hdr_quantile> > histogram_t;
+    typedef accumulator_set<
+        int
+      , stats<tag::rolling<tag::min>, tag::rolling<tag::max>, tag::rolling<tag::hdr_quantile> >
+    > accumulator_t;
+
+    boost::lagged_fibonacci607 rng;
+    std::size_t const sizes[] = {1, 2, 7, 100};
+
+    for(std::size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+    {
+        accumulator_t acc(tag::rolling_window::window_size = sizes[k]);
+        std::deque<int> window;
+        for(int i = 0; i < 1000; ++i)
+        {
+            // runs of rising and falling samples
+            int x = (i / 50 % 2) ? static_cast<int>(1000. * rng()) : 1000 - i % 50;
+            acc(x);
+            window.push_back(x);
+            if(window.size() > sizes[k])
+            {
+                window.pop_front();
+            }
+
+            histogram_t histogram;
+            for(std::size_t j = 0; j < window.size(); ++j)
+            {
+                histogram(window[j]);
+            }
+
+            BOOST_CHECK_EQUAL(*std::min_element(window.begin(), window.end()), rolling<tag::min>(acc));
+            BOOST_CHECK_EQUAL(*std::max_element(window.begin(), window.end()), rolling<tag::max>(acc));
+            BOOST_CHECK_EQUAL(
+                hdr_quantile(histogram, quantile_probability = 0.9)
+              , rolling<tag::hdr_quantile>(acc, rolling_feature_parameters = (quantile_probability = 0.9))
+            );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_tail
+//   the tail quantile of the window, from merged tails, with the cache size
+//   and the probability given to the tails among several named parameters
+//
+void test_tail()
+{
+    accumulator_set<int, stats<tag::rolling<tag::tail_quantile<right> > > > acc(
+        tag::rolling_window::window_size = 50
+      , tag::rolling<tag::tail_quantile<right> >::feature_parameters = (
+            right_tail_cache_size = 10
+          , left_tail_cache_size = 10
+        )
+    );
+
+    std::deque<int> window;
+    for(int i = 0; i < 500; ++i)
+    {
+        int x = (i * 37) % 101;
+        acc(x);
+        window.push_back(x);
+        if(window.size() > 50)
+        {
+            window.pop_front();
+        }
+
+        if(window.size() >= 20)
+        {
+            std::deque<int> sorted(window);
+            std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+            std::size_t n = static_cast<std::size_t>(std::ceil(window.size() * (1. - 0.9)));
+            BOOST_CHECK_EQUAL(
+                sorted[n - 1]
+              , rolling<tag::tail_quantile<right> >(
+                    acc
+                  , rolling_feature_parameters = (quantile_probability = 0.9, right_tail_cache_size = 10)
+                )
+            );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_timed
+//   several samples leave a timed window at once
+//
+void test_timed()
+{
+    accumulator_set<int, stats<tag::timed_rolling_window<>, tag::rolling<tag::max> > >
+        acc(tag::rolling_window_duration::window_duration = 10.);
+
+    acc(5, timestamp = 0.);
+    acc(1, timestamp = 1.);
+    acc(2, timestamp = 2.);
+    BOOST_CHECK_EQUAL(5, rolling<tag::max>(acc));
+
+    acc(3, timestamp = 10.5); // 5 leaves
+    BOOST_CHECK_EQUAL(3, rolling<tag::max>(acc));
+
+    acc(0, timestamp = 12.); // 1 and 2 leave
+    BOOST_CHECK_EQUAL(3, rolling<tag::max>(acc));
+
+    acc(-1, timestamp = 100.); // all leave
+    BOOST_CHECK_EQUAL(-1, rolling<tag::max>(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    typedef accumulator_set<int, stats<tag::rolling<tag::min>, tag::rolling<tag::max> > > accumulator_t;
+
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::rolling_window::window_size = 3);
+        acc(1);
+        acc(5);
+        acc(3);
+        acc(4);
+        BOOST_CHECK_EQUAL(3, rolling<tag::min>(acc));
+        BOOST_CHECK_EQUAL(5, rolling<tag::max>(acc));
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::rolling_window::window_size = 3);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(3, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(5, rolling<tag::max>(acc));
+
+    acc(6); // 5 leaves
+    BOOST_CHECK_EQUAL(3, rolling<tag::min>(acc));
+    BOOST_CHECK_EQUAL(6, rolling<tag::max>(acc));
+    acc(7); // 3 leaves
+    BOOST_CHECK_EQUAL(4, rolling<tag::min>(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("rolling test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_scan));
+    test->add(BOOST_TEST_CASE(&test_tail));
+    test->add(BOOST_TEST_CASE(&test_timed));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
@@ -0,0 +1,141 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for rolling_min.hpp and rolling_max.hpp
+
+#include <cmath>
+#include <deque>
+#include <algorithm>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/rolling_min.hpp>
+#include <boost/accumulators/statistics/rolling_max.hpp>
+#include <boost/accumulators/statistics/rolling_sum.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+typedef accumulator_set<int, stats<tag::rolling_min, tag::rolling_max> > accumulator_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    accumulator_t acc(tag::rolling_window::window_size = 3);
+
+    acc(3);
+    BOOST_CHECK_EQUAL(3, rolling_min(acc));
+    BOOST_CHECK_EQUAL(3, rolling_max(acc));
+
+    acc(1);
+    BOOST_CHECK_EQUAL(1, rolling_min(acc));
+    BOOST_CHECK_EQUAL(3, rolling_max(acc));
+
+    acc(2);
+    BOOST_CHECK_EQUAL(1, rolling_min(acc));
+    BOOST_CHECK_EQUAL(3, rolling_max(acc));
+
+    acc(2);
+    BOOST_CHECK_EQUAL(1, rolling_min(acc));
+    BOOST_CHECK_EQUAL(2, rolling_max(acc));
+
+    acc(5);
+    BOOST_CHECK_EQUAL(2, rolling_min(acc));
+    BOOST_CHECK_EQUAL(5, rolling_max(acc));
+
+    acc(4);
+    BOOST_CHECK_EQUAL(2, rolling_min(acc));
+    BOOST_CHECK_EQUAL(5, rolling_max(acc));
+
+    acc(4);
+    BOOST_CHECK_EQUAL(4, rolling_min(acc));
+    BOOST_CHECK_EQUAL(5, rolling_max(acc));
+
+    acc(4);
+    BOOST_CHECK_EQUAL(4, rolling_min(acc));
+    BOOST_CHECK_EQUAL(4, rolling_max(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_scan
+//   the extrema are those found by scanning the window, for several window
+//   sizes, and the window is shared with the other rolling statistics
+//
+void test_scan()
+{
+    boost::lagged_fibonacci607 rng;
+    std::size_t const sizes[] = {1, 2, 7, 100};
+
+    for(std::size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+    {
+        accumulator_set<double, stats<tag::rolling_min, tag::rolling_max, tag::rolling_sum> > acc(tag::rolling_window::window_size = sizes[k]);
+        std::deque<double> window;
+        for(int i = 0; i < 2000; ++i)
+        {
+            // runs of rising and falling samples and repeated values
+            double x = (i / 50 % 2) ? std::floor(10. * rng()) : i % 50 + rng();
+            acc(x);
+            window.push_back(x);
+            if(window.size() > sizes[k])
+            {
+                window.pop_front();
+            }
+            BOOST_CHECK_EQUAL(*std::min_element(window.begin(), window.end()), rolling_min(acc));
+            BOOST_CHECK_EQUAL(*std::max_element(window.begin(), window.end()), rolling_max(acc));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::rolling_window::window_size = 3);
+        acc(1);
+        acc(5);
+        acc(3);
+        acc(4);
+        BOOST_CHECK_EQUAL(3, rolling_min(acc));
+        BOOST_CHECK_EQUAL(5, rolling_max(acc));
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::rolling_window::window_size = 3);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(3, rolling_min(acc));
+    BOOST_CHECK_EQUAL(5, rolling_max(acc));
+
+    acc(6);
+    BOOST_CHECK_EQUAL(3, rolling_min(acc));
+    BOOST_CHECK_EQUAL(6, rolling_max(acc));
+    acc(7);
+    BOOST_CHECK_EQUAL(4, rolling_min(acc));
+    BOOST_CHECK_EQUAL(7, rolling_max(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("rolling min and max test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_scan));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
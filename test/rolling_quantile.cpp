@@ -0,0 +1,156 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for rolling_quantile.hpp
+
+#include <cmath>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/rolling_quantile.hpp>
+#include <boost/accumulators/statistics/rolling_mean.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+typedef accumulator_set<int, stats<tag::rolling_median> > accumulator_t;
+
+// the sample of rank ceil(p*n) in the window, found by sorting
+template<typename Sample>
+Sample brute_force_quantile(std::deque<Sample> const &window, double p)
+{
+    std::vector<Sample> sorted(window.begin(), window.end());
+    std::size_t rank = static_cast<std::size_t>(std::ceil(p * sorted.size()));
+    rank = rank < 1 ? 1 : rank;
+    std::nth_element(sorted.begin(), sorted.begin() + (rank - 1), sorted.end());
+    return sorted[rank - 1];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    accumulator_t acc(tag::rolling_window::window_size = 4);
+
+    BOOST_CHECK_EQUAL(0, rolling_median(acc));
+
+    acc(3);
+    BOOST_CHECK_EQUAL(3, rolling_median(acc));
+
+    acc(1);
+    BOOST_CHECK_EQUAL(1, rolling_median(acc));
+
+    acc(2);
+    BOOST_CHECK_EQUAL(2, rolling_median(acc));
+
+    acc(7);
+    BOOST_CHECK_EQUAL(2, rolling_median(acc));
+
+    acc(6); // 3 leaves
+    BOOST_CHECK_EQUAL(2, rolling_median(acc));
+
+    acc(5); // 1 leaves
+    BOOST_CHECK_EQUAL(5, rolling_median(acc));
+
+    acc(5); // 2 leaves
+    BOOST_CHECK_EQUAL(5, rolling_median(acc));
+
+    accumulator_set<int, stats<tag::rolling_quantile> > high(tag::rolling_window::window_size = 4, quantile_probability = 0.75);
+    high(3);
+    high(1);
+    high(2);
+    high(7);
+    BOOST_CHECK_EQUAL(3, rolling_quantile(high));
+    high(6);
+    BOOST_CHECK_EQUAL(6, rolling_quantile(high));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_sort
+//   the quantiles are those found by sorting the window, for several window
+//   sizes and probabilities, and the window is shared with the other rolling
+//   statistics
+//
+void test_sort()
+{
+    boost::lagged_fibonacci607 rng;
+    std::size_t const sizes[] = {1, 2, 7, 100};
+    double const probabilities[] = {0.01, 0.25, 0.5, 0.9, 1.};
+
+    for(std::size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+    {
+        for(std::size_t j = 0; j < sizeof(probabilities) / sizeof(probabilities[0]); ++j)
+        {
+            accumulator_set<double, stats<tag::rolling_quantile, tag::rolling_median, tag::rolling_mean> > acc(
+                tag::rolling_window::window_size = sizes[k]
+              , quantile_probability = probabilities[j]
+            );
+            std::deque<double> window;
+            for(int i = 0; i < 1000; ++i)
+            {
+                // runs of rising and falling samples and repeated values
+                double x = (i / 50 % 2) ? std::floor(10. * rng()) : i % 50 + rng();
+                acc(x);
+                window.push_back(x);
+                if(window.size() > sizes[k])
+                {
+                    window.pop_front();
+                }
+                BOOST_CHECK_EQUAL(brute_force_quantile(window, probabilities[j]), rolling_quantile(acc));
+                BOOST_CHECK_EQUAL(brute_force_quantile(window, 0.5), rolling_median(acc));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::rolling_window::window_size = 3);
+        acc(1);
+        acc(5);
+        acc(3);
+        acc(4);
+        BOOST_CHECK_EQUAL(4, rolling_median(acc));
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::rolling_window::window_size = 3);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(4, rolling_median(acc));
+
+    acc(0); // 5 leaves
+    BOOST_CHECK_EQUAL(3, rolling_median(acc));
+    acc(9); // 3 leaves
+    BOOST_CHECK_EQUAL(4, rolling_median(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("rolling quantile test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_sort));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
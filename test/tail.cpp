@@ -3,12 +3,22 @@
 //  Boost Software License, Version 1.0. (See accompanying file
 //  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <boost/config.hpp>
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+#include <memory>
+#include <utility>
+#endif
 #include <boost/foreach.hpp>
+#include <boost/random.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics/stats.hpp>
 #include <boost/accumulators/statistics/tail.hpp>
 #include <boost/accumulators/statistics/tail_variate.hpp>
+#include <boost/accumulators/statistics/tail_quantile.hpp>
 #include <boost/accumulators/statistics/variates/covariate.hpp>
 
 using namespace boost;
@@ -111,6 +121,161 @@ void test_left_tail()
     check_tail(tail_weights(acc), "\1\2\3\6");
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// test_buffered_tail
+//
+void test_buffered_tail()
+{
+    accumulator_set<int, stats<tag::buffered_tail<right>, tag::tail_weights<right>, tag::tail_variate<int, tag::covariate1, right> >, int > acc(
+        right_tail_cache_size = 2
+    );
+
+    acc(010, weight = 2, covariate1 = 3);
+    check_tail(tail(acc), "\10");
+    check_tail(tail_variate(acc), "\3");
+    check_tail(tail_weights(acc), "\2");
+
+    acc(020, weight = 7, covariate1 = 1);
+    acc(014, weight = 6, covariate1 = 4);
+    check_tail(tail(acc), "\20\14");
+    check_tail(tail_variate(acc), "\1\4");
+    check_tail(tail_weights(acc), "\7\6");
+
+    // the buffer fills, and the selection makes 014 the threshold
+    acc(030, weight = 4, covariate1 = 5);
+    acc(001, weight = 1, covariate1 = 9);
+    acc(011, weight = 3, covariate1 = 7);
+    check_tail(tail(acc), "\30\20");
+    check_tail(tail_variate(acc), "\5\1");
+    check_tail(tail_weights(acc), "\4\7");
+
+    acc(025, weight = 8, covariate1 = 2);
+    check_tail(tail(acc), "\30\25");
+    check_tail(tail_variate(acc), "\5\2");
+    check_tail(tail_weights(acc), "\4\10");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_buffered_tail_scan
+//   the buffered tail and its variates are those of the tail, for rising,
+//   falling and random samples, and the tail statistics can use it
+//
+template<typename LeftRight>
+void test_buffered_tail_scan()
+{
+    typedef stats<tag::tail_variate<int, tag::covariate1, LeftRight>, tag::tail_quantile<LeftRight> > features;
+
+    boost::lagged_fibonacci607 rng;
+    for(int k = 0; k < 3; ++k)
+    {
+        accumulator_set<double, stats<tag::tail<LeftRight>, features> > heap(tag::tail<LeftRight>::cache_size = 10);
+        accumulator_set<double, stats<tag::buffered_tail<LeftRight>, features> > buffered(tag::tail<LeftRight>::cache_size = 10);
+
+        for(int i = 0; i < 1000; ++i)
+        {
+            double x = 0 == k ? i + rng() : 1 == k ? -i - rng() : rng();
+            heap(x, covariate1 = i);
+            buffered(x, covariate1 = i);
+
+            if(0 == i % 7)
+            {
+                std::vector<double> expected(tail(heap).begin(), tail(heap).end());
+                std::vector<double> actual(tail(buffered).begin(), tail(buffered).end());
+                BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+                std::vector<int> expected_variates(tail_variate(heap).begin(), tail_variate(heap).end());
+                std::vector<int> actual_variates(tail_variate(buffered).begin(), tail_variate(buffered).end());
+                BOOST_CHECK_EQUAL_COLLECTIONS(expected_variates.begin(), expected_variates.end(), actual_variates.begin(), actual_variates.end());
+            }
+        }
+
+        double p = is_same<LeftRight, right>::value ? 0.995 : 0.005;
+        BOOST_CHECK_EQUAL(
+            tail_quantile(heap, quantile_probability = p)
+          , tail_quantile(buffered, quantile_probability = p)
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_large_variates
+//   the variates of the samples entering the tail are stored, those of the
+//   other samples are not
+//
+template<typename Tail>
+void test_large_variates()
+{
+    accumulator_set<int, stats<Tail, tag::tail_variate<std::string, tag::covariate1, right> > > acc(
+        right_tail_cache_size = 2
+    );
+
+    for(int i = 0; i < 10; ++i)
+    {
+        acc((i * 3) % 10, covariate1 = std::string(1000, static_cast<char>('a' + i)));
+    }
+
+    std::vector<std::string> variates(tail_variate(acc).begin(), tail_variate(acc).end());
+    BOOST_REQUIRE_EQUAL(2u, variates.size());
+    BOOST_CHECK_EQUAL(std::string(1000, 'd'), variates[0]);
+    BOOST_CHECK_EQUAL(std::string(1000, 'g'), variates[1]);
+
+    // copies keep the variates
+    accumulator_set<int, stats<Tail, tag::tail_variate<std::string, tag::covariate1, right> > > copy(
+        right_tail_cache_size = 2
+    );
+    copy = acc;
+    std::vector<std::string> copied(tail_variate(copy).begin(), tail_variate(copy).end());
+    BOOST_CHECK(variates == copied);
+}
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///////////////////////////////////////////////////////////////////////////////
+// test_moved_variates
+//   variates passed as rvalues are moved into the tail, so that move-only
+//   variates can be kept
+//
+template<typename Tail>
+void test_moved_variates()
+{
+    accumulator_set<int, stats<Tail, tag::tail_variate<std::string, tag::covariate1, right> > > acc(
+        right_tail_cache_size = 2
+    );
+
+    std::string big(1000, 'x');
+    acc(3, covariate1 = std::move(big));
+    BOOST_CHECK(big.empty());
+    std::string kept(1000, 'y');
+    acc(4, covariate1 = kept);
+    BOOST_CHECK_EQUAL(1000u, kept.size());
+    check_tail(tail(acc), "\4\3");
+
+    accumulator_set<int, stats<Tail, tag::tail_variate<std::unique_ptr<int>, tag::covariate1, right> > > ptrs(
+        right_tail_cache_size = 3
+    );
+
+    for(int i = 0; i < 20; ++i)
+    {
+        ptrs((i * 7) % 20, covariate1 = std::unique_ptr<int>(new int((i * 7) % 20)));
+    }
+
+    check_tail(tail(ptrs), "\23\22\21");
+    BOOST_FOREACH(std::unique_ptr<int> const &p, tail_variate(ptrs))
+    {
+        BOOST_REQUIRE(p);
+    }
+    BOOST_CHECK_EQUAL(19, **tail_variate(ptrs).begin());
+    BOOST_CHECK_EQUAL(17, **(tail_variate(ptrs).begin() + 2));
+
+    // a set holding move-only variates cannot be copied, an empty one can
+    typedef accumulator_set<int, stats<Tail, tag::tail_variate<std::unique_ptr<int>, tag::covariate1, right> > > ptrs_type;
+    BOOST_CHECK_THROW(ptrs_type copy(ptrs), std::logic_error);
+    ptrs_type empty(right_tail_cache_size = 3);
+    ptrs_type copy(empty);
+    BOOST_CHECK_THROW(copy = ptrs, std::logic_error);
+    copy = empty;
+    BOOST_CHECK(tail_variate(copy).empty());
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
 //
@@ -120,6 +285,15 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
 
     test->add(BOOST_TEST_CASE(&test_right_tail));
     test->add(BOOST_TEST_CASE(&test_left_tail));
+    test->add(BOOST_TEST_CASE(&test_buffered_tail));
+    test->add(BOOST_TEST_CASE(&test_buffered_tail_scan<right>));
+    test->add(BOOST_TEST_CASE(&test_buffered_tail_scan<left>));
+    test->add(BOOST_TEST_CASE(&test_large_variates<tag::tail<right> >));
+    test->add(BOOST_TEST_CASE(&test_large_variates<tag::buffered_tail<right> >));
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    test->add(BOOST_TEST_CASE(&test_moved_variates<tag::tail<right> >));
+    test->add(BOOST_TEST_CASE(&test_moved_variates<tag::buffered_tail<right> >));
+#endif
 
     return test;
 }
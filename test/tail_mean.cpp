@@ -5,6 +5,10 @@
 
 // Test case for tail_mean.hpp
 
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <numeric>
 #include <boost/random.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
@@ -72,6 +76,65 @@ void test_stat()
     BOOST_CHECK_CLOSE( tail_mean(acc3, quantile_probability = 0.001), 0.0005, 25*epsilon );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// test_interleaved
+//   queries between samples, which select from the unsorted tail, agree with
+//   the sorted tail, and so do queries after it is sorted
+//
+template<typename Tail, typename LeftRight>
+void test_interleaved()
+{
+    typedef accumulator_set<double, stats<Tail, tag::non_coherent_tail_mean<LeftRight>, tag::tail_quantile<LeftRight> > > accumulator_t;
+    double const probabilities[] = {0.9, 0.99, 0.995, 0.999};
+
+    accumulator_t acc(tag::tail<LeftRight>::cache_size = 50);
+    boost::lagged_fibonacci607 rng;
+
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        acc(rng());
+        if (0 != i % 97)
+            continue;
+
+        double expected_quantiles[4], expected_means[4];
+        std::vector<double> quantiles, means;
+        for (int sorted = 0; sorted < 2; ++sorted)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                double p = is_same<LeftRight, right>::value ? probabilities[j] : 1. - probabilities[j];
+                quantiles.push_back(tail_quantile(acc, quantile_probability = p));
+                means.push_back(non_coherent_tail_mean(acc, quantile_probability = p));
+            }
+            if (0 == sorted)
+            {
+                // tail() sorts the tail, the queries above must not have
+                std::vector<double> samples(tail(acc).begin(), tail(acc).end());
+                for (int j = 0; j < 4; ++j)
+                {
+                    std::size_t n = static_cast<std::size_t>(std::ceil(count(acc) * (1. - probabilities[j])));
+                    expected_quantiles[j] = n < samples.size() ? samples[n - 1] : std::numeric_limits<double>::quiet_NaN();
+                    expected_means[j] = n <= samples.size()
+                      ? std::accumulate(samples.begin(), samples.begin() + n, 0.) / n
+                      : std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }
+
+        for (int k = 0; k < 8; ++k)
+        {
+            if (expected_quantiles[k % 4] == expected_quantiles[k % 4])
+                BOOST_CHECK_EQUAL(expected_quantiles[k % 4], quantiles[k]);
+            else
+                BOOST_CHECK(quantiles[k] != quantiles[k]);
+            if (expected_means[k % 4] == expected_means[k % 4])
+                BOOST_CHECK_CLOSE(expected_means[k % 4], means[k], 1e-10);
+            else
+                BOOST_CHECK(means[k] != means[k]);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
 //
@@ -80,6 +143,10 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test_suite *test = BOOST_TEST_SUITE("tail_mean test");
 
     test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE((&test_interleaved<tag::tail<right>, right>)));
+    test->add(BOOST_TEST_CASE((&test_interleaved<tag::tail<left>, left>)));
+    test->add(BOOST_TEST_CASE((&test_interleaved<tag::buffered_tail<right>, right>)));
+    test->add(BOOST_TEST_CASE((&test_interleaved<tag::buffered_tail<left>, left>)));
 
     return test;
 }
@@ -0,0 +1,225 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for tdigest.hpp
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/tdigest.hpp>
+#include <boost/accumulators/statistics/weighted_tdigest.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace boost::accumulators;
+
+typedef accumulator_set<double, stats<tag::tdigest_quantile, tag::tdigest_cdf> > accumulator_t;
+
+double const probabilities[] = {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+
+// the error allowed for the quantile and the distribution function at p,
+// which shrinks towards the tails
+double tolerance(double p)
+{
+    return 0.004 * std::sqrt(p * (1 - p)) + 2e-5;
+}
+
+// the quantile and distribution function of the sorted samples
+double exact_quantile(std::vector<double> const &sorted, double p)
+{
+    return sorted[static_cast<std::size_t>(p * sorted.size())];
+}
+
+double exact_cdf(std::vector<double> const &sorted, double x)
+{
+    return double(std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / sorted.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+void test_stat()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_t acc;
+    std::vector<double> samples;
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        acc(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(quantile(acc, quantile_probability = p) - exact_quantile(samples, p), tolerance(p));
+        BOOST_CHECK_SMALL(tdigest_cdf(acc, sample = p) - exact_cdf(samples, p), tolerance(p));
+    }
+
+    // the extremes are exact
+    BOOST_CHECK_EQUAL(samples.front(), quantile(acc, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(samples.back(), quantile(acc, quantile_probability = 1.));
+    BOOST_CHECK_EQUAL(0., tdigest_cdf(acc, sample = -1.));
+    BOOST_CHECK_EQUAL(1., tdigest_cdf(acc, sample = 2.));
+
+    // the number of centroids is bounded by the compression
+    BOOST_CHECK_LE(tdigest(acc).size(), 200u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_small
+//   with few samples every centroid holds a single sample, and the quantiles
+//   and distribution function are exact
+//
+void test_small()
+{
+    accumulator_t acc;
+    for (int i=1; i<=10; ++i)
+    {
+        acc(i);
+    }
+
+    BOOST_CHECK_EQUAL(10u, tdigest(acc).size());
+    BOOST_CHECK_EQUAL(1., quantile(acc, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(10., quantile(acc, quantile_probability = 1.));
+    BOOST_CHECK_EQUAL(3., quantile(acc, quantile_probability = 0.25));
+    BOOST_CHECK_EQUAL(0.25, tdigest_cdf(acc, sample = 3.));
+    BOOST_CHECK_EQUAL(0.5, tdigest_cdf(acc, sample = 5.5));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_merge
+//   four digests over disjoint parts of the samples, merged; every merge
+//   costs a little accuracy
+//
+void test_merge()
+{
+    boost::lagged_fibonacci607 rng;
+
+    std::vector<double> samples;
+    accumulator_t parts[4];
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        parts[i % 4](sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    accumulator_t merged;
+    for (int i=0; i<4; ++i)
+    {
+        merged.merge(parts[i]);
+    }
+
+    BOOST_CHECK_LE(tdigest(merged).size(), 200u);
+    BOOST_CHECK_EQUAL(samples.front(), quantile(merged, quantile_probability = 0.));
+    BOOST_CHECK_EQUAL(samples.back(), quantile(merged, quantile_probability = 1.));
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(quantile(merged, quantile_probability = p) - exact_quantile(samples, p), 2 * tolerance(p));
+        BOOST_CHECK_SMALL(tdigest_cdf(merged, sample = p) - exact_cdf(samples, p), 2 * tolerance(p));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_weighted
+//   a sample of weight k counts as k samples
+//
+void test_weighted()
+{
+    boost::lagged_fibonacci607 rng;
+
+    accumulator_set<double, stats<tag::tdigest_quantile, tag::tdigest_cdf>, double> acc(tag::tdigest::compression = 200);
+    std::vector<double> samples;
+    for (int i=0; i<50000; ++i)
+    {
+        double sample = rng();
+        int k = 1 + i % 3;
+        samples.insert(samples.end(), k, sample);
+        acc(sample, weight = k);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (std::size_t i = 0; i < sizeof(probabilities) / sizeof(double); ++i)
+    {
+        double p = probabilities[i];
+        BOOST_CHECK_SMALL(quantile(acc, quantile_probability = p) - exact_quantile(samples, p), tolerance(p));
+        BOOST_CHECK_SMALL(weighted_tdigest_cdf(acc, sample = p) - exact_cdf(samples, p), tolerance(p));
+    }
+
+    // the same weight for every sample, not an integer, gives the unweighted digest
+    accumulator_set<double, stats<tag::tdigest_quantile, tag::tdigest_cdf>, double> light;
+    samples.clear();
+    for (int i=0; i<100000; ++i)
+    {
+        double sample = rng();
+        samples.push_back(sample);
+        light(sample, weight = 0.01);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    double const tails[] = {0.0005, 0.001, 0.01, 0.5, 0.99, 0.999, 0.9995};
+    for (std::size_t i = 0; i < sizeof(tails) / sizeof(double); ++i)
+    {
+        double p = tails[i];
+        BOOST_CHECK_SMALL(quantile(light, quantile_probability = p) - exact_quantile(samples, p), tolerance(p));
+        BOOST_CHECK_SMALL(weighted_tdigest_cdf(light, sample = p) - exact_cdf(samples, p), tolerance(p));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    // "persistent" storage
+    std::stringstream ss;
+    // a random number generator
+    boost::lagged_fibonacci607 rng;
+    double q99 = 0.;
+    {
+        accumulator_t acc;
+        for (int i=0; i<100000; ++i)
+        {
+            acc(rng());
+        }
+        q99 = quantile(acc, quantile_probability = 0.99);
+        BOOST_CHECK_SMALL(q99 - 0.99, 0.001);
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc;
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_CLOSE(q99, quantile(acc, quantile_probability = 0.99), 1e-6);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tdigest test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_small));
+    test->add(BOOST_TEST_CASE(&test_merge));
+    test->add(BOOST_TEST_CASE(&test_weighted));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
@@ -0,0 +1,242 @@
+//  (C) Copyright the Boost.Accumulators contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test case for timed_rolling_window.hpp
+
+#include <deque>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/timed_rolling_window.hpp>
+#include <boost/accumulators/statistics/rolling_count.hpp>
+#include <boost/accumulators/statistics/rolling_sum.hpp>
+#include <boost/accumulators/statistics/rolling_mean.hpp>
+#include <boost/accumulators/statistics/rolling_moment.hpp>
+#include <boost/accumulators/statistics/rolling_variance.hpp>
+#include <boost/accumulators/statistics/rolling_quantile.hpp>
+#include <boost/accumulators/statistics/rolling_min.hpp>
+#include <boost/accumulators/statistics/rolling_max.hpp>
+#include <sstream>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+using namespace boost;
+using namespace unit_test;
+using namespace accumulators;
+
+template<typename T>
+void check_equal(std::vector<T> const &v1, std::vector<T> const &v2)
+{
+    BOOST_CHECK_EQUAL_COLLECTIONS(v1.begin(), v1.end(), v2.begin(), v2.end());
+}
+
+template<typename Range>
+std::vector<typename Range::value_type> to_vector(Range const &r)
+{
+    return std::vector<typename Range::value_type>(r.begin(), r.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_stat
+//
+void test_stat()
+{
+    accumulator_set<int, stats<tag::timed_rolling_window<>, tag::rolling_count, tag::rolling_sum, tag::rolling_mean> >
+        acc(tag::timed_rolling_window<>::window_duration = 10.);
+    std::vector<int> expected;
+
+    BOOST_CHECK_EQUAL(0u, rolling_count(acc));
+
+    acc(1, timestamp = 0.);
+    acc(2, timestamp = 1.);
+    acc(3, timestamp = 5.);
+    expected.push_back(1);
+    expected.push_back(2);
+    expected.push_back(3);
+    check_equal(expected, to_vector(rolling_window(acc)));
+    BOOST_CHECK_EQUAL(3u, rolling_count(acc));
+    BOOST_CHECK_EQUAL(6, rolling_sum(acc));
+    BOOST_CHECK_CLOSE(2., rolling_mean(acc), 1e-10);
+
+    // the sample at 0. leaves at 10.
+    acc(4, timestamp = 10.);
+    expected.erase(expected.begin());
+    expected.push_back(4);
+    check_equal(expected, to_vector(rolling_window(acc)));
+    BOOST_CHECK_EQUAL(9, rolling_sum(acc));
+    BOOST_CHECK_CLOSE(3., rolling_mean(acc), 1e-10);
+
+    // several samples leave at once
+    acc(5, timestamp = 15.5);
+    expected.assign(1, 4);
+    expected.push_back(5);
+    check_equal(expected, to_vector(rolling_window(acc)));
+    BOOST_CHECK_EQUAL(2u, rolling_count(acc));
+    BOOST_CHECK_EQUAL(9, rolling_sum(acc));
+    BOOST_CHECK_CLOSE(4.5, rolling_mean(acc), 1e-10);
+
+    // all of them, but the latest sample is always in the window
+    acc(6, timestamp = 100.);
+    expected.assign(1, 6);
+    check_equal(expected, to_vector(rolling_window(acc)));
+    BOOST_CHECK_EQUAL(1u, rolling_count(acc));
+    BOOST_CHECK_EQUAL(6, rolling_sum(acc));
+    BOOST_CHECK_CLOSE(6., rolling_mean(acc), 1e-10);
+
+    // samples at the same time
+    acc(7, timestamp = 100.);
+    acc(8, timestamp = 100.);
+    BOOST_CHECK_EQUAL(3u, rolling_count(acc));
+    BOOST_CHECK_EQUAL(21, rolling_sum(acc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_scan
+//   the statistics are those of the samples of the last period of time, for
+//   irregular and bursty timestamps
+//
+void test_scan()
+{
+    typedef accumulator_set<
+        double
+      , stats<
+            tag::timed_rolling_window_plus1<>
+          , tag::rolling_count
+          , tag::rolling_sum
+          , tag::rolling_mean
+          , tag::lazy_rolling_mean
+          , tag::rolling_moment<2>
+          , tag::rolling_variance
+          , tag::lazy_rolling_variance
+          , tag::rolling_median
+          , tag::rolling_min
+          , tag::rolling_max
+        >
+    > accumulator_t;
+
+    boost::lagged_fibonacci607 rng;
+    double const durations[] = {0.5, 3., 50.};
+
+    for(std::size_t k = 0; k < sizeof(durations) / sizeof(durations[0]); ++k)
+    {
+        accumulator_t acc(tag::rolling_window_duration::window_duration = durations[k]);
+        std::deque<double> window, times;
+        double t = 0.;
+        for(int i = 0; i < 2000; ++i)
+        {
+            // bursts of samples at the same time and gaps of several windows
+            t += (i % 37 == 0) ? 2. * durations[k] * rng() : (i % 5 == 0) ? 0. : 0.2 * rng();
+            double x = 10. * rng() - 3.;
+            acc(x, timestamp = t);
+            window.push_back(x);
+            times.push_back(t);
+            while(!(t - times.front() < durations[k]) && 1 < times.size())
+            {
+                window.pop_front();
+                times.pop_front();
+            }
+
+            std::size_t const n = window.size();
+            double const sum = std::accumulate(window.begin(), window.end(), 0.);
+            double const mean = sum / n;
+            double sum_of_squares = 0.;
+            for(std::size_t j = 0; j < n; ++j)
+            {
+                sum_of_squares += (window[j] - mean) * (window[j] - mean);
+            }
+            std::vector<double> sorted(window.begin(), window.end());
+            std::nth_element(sorted.begin(), sorted.begin() + (n - 1) / 2, sorted.end());
+
+            BOOST_CHECK_EQUAL(n, rolling_count(acc));
+            BOOST_CHECK_CLOSE(sum, rolling_sum(acc), 1e-6);
+            BOOST_CHECK_CLOSE(mean, rolling_mean(acc), 1e-6);
+            BOOST_CHECK_CLOSE(mean, lazy_rolling_mean(acc), 1e-6);
+            BOOST_CHECK_CLOSE(sum_of_squares / n + mean * mean, rolling_moment<2>(acc), 1e-6);
+            BOOST_CHECK_EQUAL(sorted[(n - 1) / 2], rolling_median(acc));
+            BOOST_CHECK_EQUAL(*std::min_element(window.begin(), window.end()), rolling_min(acc));
+            BOOST_CHECK_EQUAL(*std::max_element(window.begin(), window.end()), rolling_max(acc));
+            if(n > 1)
+            {
+                BOOST_CHECK_CLOSE(sum_of_squares / (n - 1), rolling_variance(acc), 1e-6);
+                BOOST_CHECK_CLOSE(sum_of_squares / (n - 1), lazy_rolling_variance(acc), 1e-6);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_integral_timestamps
+//   nanoseconds since the epoch, which a double cannot represent exactly
+//
+void test_integral_timestamps()
+{
+    typedef boost::int64_t nanoseconds;
+    accumulator_set<int, stats<tag::timed_rolling_window<nanoseconds>, tag::rolling_sum> >
+        acc(tag::timed_rolling_window<nanoseconds>::window_duration = nanoseconds(1000));
+
+    nanoseconds const start = nanoseconds(1760000000) * 1000000000 + 1;
+    acc(1, timestamp = start);
+    acc(2, timestamp = start + 999);
+    BOOST_CHECK_EQUAL(3, rolling_sum(acc));
+    acc(4, timestamp = start + 1000);
+    BOOST_CHECK_EQUAL(6, rolling_sum(acc));
+    acc(8, timestamp = start + 1998);
+    BOOST_CHECK_EQUAL(14, rolling_sum(acc));
+    acc(16, timestamp = start + 1999);
+    BOOST_CHECK_EQUAL(28, rolling_sum(acc));
+    BOOST_CHECK_EQUAL(3u, rolling_window(acc).size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_persistency
+//
+void test_persistency()
+{
+    typedef accumulator_set<int, stats<tag::timed_rolling_window<>, tag::rolling_sum, tag::rolling_mean> > accumulator_t;
+
+    std::stringstream ss;
+    {
+        accumulator_t acc(tag::timed_rolling_window<>::window_duration = 10.);
+        acc(1, timestamp = 0.);
+        acc(2, timestamp = 4.);
+        acc(3, timestamp = 10.);
+        BOOST_CHECK_EQUAL(5, rolling_sum(acc));
+        boost::archive::text_oarchive oa(ss);
+        acc.serialize(oa, 0);
+    }
+    accumulator_t acc(tag::timed_rolling_window<>::window_duration = 1.);
+    boost::archive::text_iarchive ia(ss);
+    acc.serialize(ia, 0);
+    BOOST_CHECK_EQUAL(5, rolling_sum(acc));
+    BOOST_CHECK_CLOSE(2.5, rolling_mean(acc), 1e-10);
+
+    // the duration is restored too
+    acc(4, timestamp = 12.);
+    BOOST_CHECK_EQUAL(9, rolling_sum(acc));
+    acc(5, timestamp = 14.);
+    BOOST_CHECK_EQUAL(12, rolling_sum(acc));
+    BOOST_CHECK_EQUAL(3u, rolling_window(acc).size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("timed rolling window test");
+
+    test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_scan));
+    test->add(BOOST_TEST_CASE(&test_integral_timestamps));
+    test->add(BOOST_TEST_CASE(&test_persistency));
+
+    return test;
+}
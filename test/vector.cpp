@@ -16,6 +16,11 @@
 #include <boost/accumulators/statistics/max.hpp>
 #include <boost/accumulators/statistics/mean.hpp>
 #include <boost/accumulators/statistics/weighted_mean.hpp>
+#include <boost/accumulators/statistics/moment.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/weighted_sum.hpp>
+#include <boost/accumulators/statistics/weighted_moment.hpp>
+#include <boost/accumulators/statistics/weighted_variance.hpp>
 
 using namespace boost;
 using namespace unit_test;
@@ -167,6 +172,49 @@ void test_stat()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// test_in_place
+//   the statistics of vector samples, updated in place, agree with those of
+//   the components
+//
+void test_in_place()
+{
+    typedef std::vector<double> sample_t;
+    typedef accumulator_set<double, stats<tag::variance, tag::moment<3> > > scalar_t;
+    typedef accumulator_set<double, stats<tag::weighted_sum, tag::weighted_variance, tag::weighted_moment<3> >, double> weighted_scalar_t;
+
+    sample_t zero(3, 0.);
+    accumulator_set<sample_t, stats<tag::variance, tag::moment<3> > > acc(sample = zero);
+    accumulator_set<sample_t, stats<tag::weighted_sum, tag::weighted_variance, tag::weighted_moment<3> >, double> wacc(sample = zero);
+    scalar_t scalars[3];
+    weighted_scalar_t weighted_scalars[3];
+
+    sample_t x(3);
+    for(int i = 0; i < 100; ++i)
+    {
+        double const w = 1. + i % 3;
+        for(std::size_t j = 0; j < 3; ++j)
+        {
+            x[j] = (i * (j + 1)) % 17 - 0.5 * j;
+            scalars[j](x[j]);
+            weighted_scalars[j](x[j], weight = w);
+        }
+        acc(x);
+        wacc(x, weight = w);
+    }
+
+    for(std::size_t j = 0; j < 3; ++j)
+    {
+        BOOST_CHECK_EQUAL(mean(scalars[j]), mean(acc)[j]);
+        BOOST_CHECK_EQUAL(variance(scalars[j]), variance(acc)[j]);
+        BOOST_CHECK_EQUAL(moment<3>(scalars[j]), moment<3>(acc)[j]);
+        BOOST_CHECK_EQUAL(weighted_sum(weighted_scalars[j]), weighted_sum(wacc)[j]);
+        BOOST_CHECK_EQUAL(weighted_mean(weighted_scalars[j]), weighted_mean(wacc)[j]);
+        BOOST_CHECK_EQUAL(weighted_variance(weighted_scalars[j]), weighted_variance(wacc)[j]);
+        BOOST_CHECK_EQUAL(weighted_moment<3>(weighted_scalars[j]), weighted_moment<3>(wacc)[j]);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
 //
@@ -175,6 +223,7 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test_suite *test = BOOST_TEST_SUITE("vector test");
 
     test->add(BOOST_TEST_CASE(&test_stat));
+    test->add(BOOST_TEST_CASE(&test_in_place));
 
     return test;
 }